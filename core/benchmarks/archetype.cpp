@@ -0,0 +1,91 @@
+#include <chrono>
+#include <cstdio>
+
+#include "ecs/ecs.hpp"
+
+using namespace rome;
+using namespace rome::core;
+
+namespace {
+    struct Position {
+        f32 x, y, z;
+
+        RM_REFLECT;
+    };
+    struct Velocity {
+        f32 dx, dy, dz;
+
+        RM_REFLECT;
+    };
+    struct Health {
+        f32 value;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Position, "BenchPosition");
+RM_REFLECT_IMPL(Velocity, "BenchVelocity");
+RM_REFLECT_IMPL(Health, "BenchHealth");
+
+namespace {
+    constexpr u64 Entities = 200000;
+    constexpr u64 Frames = 100;
+
+    /**
+     * @brief Times a system iterating positions and velocities on the given backend.
+     * Every third entity lacks a velocity and every fifth has a health, so the archetype storage spreads the entities
+     * over four archetypes, while the sparse-set group packs its two pools.
+     * @param backend The component storage backend.
+     * @param parallel Whether the system splits its view over the job system.
+     * @return The average time of a frame in milliseconds.
+     */
+    f64 time(ECS::Backend backend, b8 parallel) {
+        ECS ecs(backend);
+        World& world = ecs.getWorld();
+        for (u64 i = 0; i < Entities; i++) {
+            const Entity entity = ecs.createEntity();
+            ecs.addComponent<Position>(entity, 0.0f, 0.0f, 0.0f);
+            if (i % 3 != 0) ecs.addComponent<Velocity>(entity, 1.0f, 2.0f, 3.0f);
+            if (i % 5 == 0) ecs.addComponent<Health>(entity, 100.0f);
+        }
+
+        ecs.registerSystem(System::Builder("move", world).writes<Position>().reads<Velocity>().requireFull().build([parallel](System::Context& ctx) {
+            auto move = [](Position& position, const Velocity& velocity) {
+                position.x += velocity.dx;
+                position.y += velocity.dy;
+                position.z += velocity.dz;
+            };
+            System::View<Position, const Velocity> view(ctx);
+            parallel ? view.parallelEach(move) : view.each(move);
+        }));
+
+        ecs.update();  // Warm up
+        const auto begin = std::chrono::steady_clock::now();
+        for (u64 frame = 0; frame < Frames; frame++) {
+            ecs.update();
+        }
+        return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - begin).count() / Frames;
+    }
+
+    /**
+     * @brief Times a workload on both backends.
+     * @param name The name of the workload.
+     * @param parallel Whether the system splits its view over the job system.
+     */
+    void compare(const char* name, b8 parallel) {
+        const f64 sparse = time(ECS::Backend::SparseSet, parallel);
+        const f64 archetype = time(ECS::Backend::Archetype, parallel);
+        std::printf("%-24s sparse-set %9.3f ms   archetype %9.3f ms   x%.2f\n", name, sparse, archetype, sparse / archetype);
+    }
+}  // namespace
+
+/**
+ * @brief Compares System::View iteration on the sparse-set and archetype backends, per frame.
+ * Both walk contiguous memory: the sparse-set view the front of its packed pools, the archetype view the chunks of
+ * every matching archetype, looking up the run of every batch.
+ */
+int main() {
+    compare("view each", false);
+    compare("view parallelEach", true);
+    return 0;
+}
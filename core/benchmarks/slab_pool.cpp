@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdio>
+
+#include "container/sparse_set.hpp"
+#include "memory/slab_pool.hpp"
+
+using namespace rome;
+using namespace rome::core;
+
+namespace {
+    struct Transform {
+        f64 position[3];
+        f64 rotation[4];
+    };
+
+    /**
+     * @brief Times a workload against the global heap and against a slab pool.
+     * @param name The name of the workload.
+     * @param workload Runs the workload, allocating from the given resource.
+     */
+    template <typename Workload>
+    void compare(const char* name, Workload&& workload) {
+        auto time = [&](std::pmr::memory_resource* resource) {
+            const auto begin = std::chrono::steady_clock::now();
+            workload(resource);
+            return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - begin).count();
+        };
+
+        time(std::pmr::new_delete_resource());  // Warm up
+        const f64 heap = time(std::pmr::new_delete_resource());
+        SlabPool pool;
+        time(&pool);  // Warm up, the slabs are then reused
+        const f64 slab = time(&pool);
+        std::printf("%-24s heap %9.3f ms   slab %9.3f ms   x%.2f\n", name, heap, slab, heap / slab);
+    }
+}  // namespace
+
+/**
+ * @brief Compares SlabPool against the global heap on component-like workloads.
+ * Insert-heavy fills many short-lived sets from empty, so every growth step allocates. Churn-heavy keeps many small
+ * sets alive and repeatedly empties and refills them, the pattern of per-frame event queues and transient components.
+ */
+int main() {
+    compare("insert-heavy", [](std::pmr::memory_resource* resource) {
+        for (u64 round = 0; round < 200; round++) {
+            SparseSet<Transform> set(resource);
+            for (u64 i = 0; i < 10000; i++) {
+                set.insert(i, Transform{});
+            }
+        }
+    });
+
+    compare("churn-heavy", [](std::pmr::memory_resource* resource) {
+        // Small pages, so the sparse pages (always on the heap) do not drown out the dense arrays
+        using Set = SparseSet<Transform, u32, 64>;
+        std::vector<Set> sets;
+        for (u64 i = 0; i < 256; i++) {
+            sets.emplace_back(resource);
+        }
+        for (u64 round = 0; round < 200; round++) {
+            for (Set& set : sets) {
+                set = Set(resource);
+                for (u64 i = 0; i < 64; i++) {
+                    set.insert(i * 7, Transform{});
+                }
+            }
+        }
+    });
+
+    compare("churn-heavy (events)", [](std::pmr::memory_resource* resource) {
+        for (u64 frame = 0; frame < 20000; frame++) {
+            std::pmr::vector<Transform> back(resource);
+            for (u64 i = 0; i < 32; i++) {
+                back.push_back(Transform{});
+            }
+        }
+    });
+    return 0;
+}
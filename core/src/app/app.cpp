@@ -1,17 +1,25 @@
 #include "app/app.hpp"
 
+#include "app/headless.hpp"
 #include "app/twin_threads.hpp"
 
 namespace rome::core {
     Application::Application(const Config& config)
         : config(config),
-          strategy(std::move(MakeUnique<TwinStrategy>(*this))),
+          strategy(config.isHeadless ? Unique<ApplicationStrategy>(MakeUnique<HeadlessStrategy>(*this, config.isFastForward, config.tickLimit))
+                                     : Unique<ApplicationStrategy>(MakeUnique<TwinStrategy>(*this, true, config.pacing, config.maxCatchUpTicks))),
           tickRate(config.tickRate, config.tickRateWindow),
           renderRate(config.renderRate, config.renderRateWindow) {
         if (config.isMemoryLogging) {
             rome::core::Metrics::getInstance().registerThread("Main");
             rome::core::Metrics::getInstance().setIsMemoryTracking(true);
         }
+        if (config.isAsyncLogging) {
+            Logger::getInstance().start();
+        }
+        if (config.isPerformanceLogging) {
+            Profiler::getInstance().start();
+        }
     }
 
     Application::Application(const Config& config, Unique<ApplicationStrategy>&& strategy)
@@ -23,6 +31,26 @@ namespace rome::core {
             rome::core::Metrics::getInstance().registerThread("Main");
             rome::core::Metrics::getInstance().setIsMemoryTracking(true);
         }
+        if (config.isAsyncLogging) {
+            Logger::getInstance().start();
+        }
+        if (config.isPerformanceLogging) {
+            Profiler::getInstance().start();
+        }
+    }
+
+    Application::~Application() {
+        if (config.isPerformanceLogging) {
+            Profiler::getInstance().stop();
+            if (Profiler::getInstance().exportTrace(config.tracePath)) {
+                RM_INFO("Wrote profiler capture to %s", config.tracePath.c_str());
+            } else {
+                RM_ERROR("Failed to write profiler capture to %s", config.tracePath.c_str());
+            }
+        }
+        if (config.isAsyncLogging) {
+            Logger::getInstance().stop();
+        }
     }
 
     void Application::start() { strategy->start(config.tickRate, config.renderRate); }
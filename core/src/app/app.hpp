@@ -1,8 +1,11 @@
 #pragma once
 
 #include "app/strategy.hpp"
+#include "chrono/pacer.hpp"
 #include "chrono/rate.hpp"
+#include "debug/log.hpp"
 #include "debug/metrics.hpp"
+#include "debug/profiler.hpp"
 
 namespace rome::core {
     /**
@@ -14,7 +17,7 @@ namespace rome::core {
         struct Config;
 
         /**
-         * @brief Creates a new application with the default strategy.
+         * @brief Creates a new application with the default strategy: TwinStrategy, or HeadlessStrategy if config.isHeadless is set.
          * @param config The configuration for the application.
          */
         Application(const Config& config);
@@ -24,7 +27,10 @@ namespace rome::core {
          * @param strategy The strategy for the application.
          */
         Application(const Config& config, Unique<ApplicationStrategy>&& strategy);
-        virtual ~Application() = default;
+        /**
+         * @brief Destroys the application, writing the profiler capture if performance logging is on.
+         */
+        virtual ~Application();
 
         /**
          * @brief Initializes the application.
@@ -38,7 +44,7 @@ namespace rome::core {
 
         /**
          * @brief Runs at a fixed time step.
-         * @param dt The time since the last tick.
+         * @param dt The fixed time step, 1 / tickRate.
          */
         virtual void tick(f64 dt) = 0;
 
@@ -48,6 +54,21 @@ namespace rome::core {
          */
         virtual void render(f64 dt) = 0;
 
+        /**
+         * @brief Runs as fast as possible, knowing where the frame falls between the last two ticks.
+         * Override this instead of render(dt) to blend the previous and latest simulation states rather than ticking faster.
+         * @param dt The time since the last frame.
+         * @param alpha How far past the latest tick the frame is, as a fraction of the time step in [0, 1].
+         * @note Defaults to render(dt).
+         */
+        virtual void render(f64 dt, f64 /*alpha*/) { render(dt); }
+
+        /**
+         * @brief Runs on the tick thread right after every tick, to hand the render thread what it needs.
+         * @note Does nothing by default. See SnapshotApplication.
+         */
+        virtual void publish() {}
+
         /**
          * @brief Starts or resumes the application.
          */
@@ -66,13 +87,20 @@ namespace rome::core {
          */
         struct Config {
             // General settings.
-            std::string title = "Rome";  ///< The title of the application. Window title should default to this.
-            u32 tickRate = 60;           ///< The target update rate of the application.
-            u32 renderRate = 60;         ///< The target framerate of the application. 0 will sync with tick rate.
+            std::string title = "Rome";                          ///< The title of the application. Window title should default to this.
+            u32 tickRate = 60;                                   ///< The target update rate of the application.
+            u32 renderRate = 60;                                 ///< The target framerate of the application. 0 will sync with tick rate.
+            u32 maxCatchUpTicks = 5;                             ///< The most ticks run per frame to catch up. Excess time is dropped.
+            FramePacer::Mode pacing = FramePacer::Mode::Hybrid;  ///< How the default strategy waits for its next frame.
+            b8 isHeadless = false;                               ///< Whether to only tick, on the calling thread. See HeadlessStrategy.
+            b8 isFastForward = false;                            ///< Whether a headless application ticks back-to-back.
+            u64 tickLimit = 0;                                   ///< The ticks after which a headless application stops, 0 for none.
 
             // Metrics. Enable as needed.
-            b8 isMemoryLogging = false;       ///< Whether to log memory allocations.
-            b8 isPerformanceLogging = false;  ///< Whether to log performance metrics.
+            b8 isMemoryLogging = false;            ///< Whether to log memory allocations.
+            b8 isAsyncLogging = false;             ///< Whether to format and write logs on a background thread.
+            b8 isPerformanceLogging = false;       ///< Whether to record profiler zones. See RM_PROFILE_SCOPE.
+            std::string tracePath = "trace.json";  ///< Where the profiler capture is written on shutdown.
 
             // These are not too important, just leave them as they are.
             f64 tickRateWindow = 1.0f;    ///< The window to average the tick rate over (in seconds).
@@ -109,16 +137,47 @@ namespace rome::core {
                 return *this;
             }
 
+            Builder& setMaxCatchUpTicks(u32 maxCatchUpTicks) {
+                config.maxCatchUpTicks = maxCatchUpTicks;
+                return *this;
+            }
+
+            Builder& setPacing(FramePacer::Mode pacing) {
+                config.pacing = pacing;
+                return *this;
+            }
+
+            Builder& enableHeadless(b8 fastForward = false) {
+                config.isHeadless = true;
+                config.isFastForward = fastForward;
+                return *this;
+            }
+
+            Builder& setTickLimit(u64 tickLimit) {
+                config.tickLimit = tickLimit;
+                return *this;
+            }
+
             Builder& enableMemoryLogging() {
                 config.isMemoryLogging = true;
                 return *this;
             }
 
+            Builder& enableAsyncLogging() {
+                config.isAsyncLogging = true;
+                return *this;
+            }
+
             Builder& enablePerformanceLogging() {
                 config.isPerformanceLogging = true;
                 return *this;
             }
 
+            Builder& setTracePath(const std::string& tracePath) {
+                config.tracePath = tracePath;
+                return *this;
+            }
+
             Config build() { return config; }
 
             private:
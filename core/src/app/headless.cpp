@@ -0,0 +1,53 @@
+#include "app/headless.hpp"
+
+#include "app/app.hpp"
+#include "debug/exception.hpp"
+#include "debug/profiler.hpp"
+#include "memory/arena.hpp"
+#include "platform/platform.hpp"
+
+namespace rome::core {
+    HeadlessStrategy::HeadlessStrategy(Application& app, b8 fastForward, u64 tickLimit)
+        : ApplicationStrategy(
+              [&app](f64 dt) {
+                  app.tick(dt);
+                  FrameArena::endFrame(FrameArena::Phase::Tick);
+              },
+              [](f64, f64) {}),
+          fastForward(fastForward),
+          tickLimit(tickLimit) {}
+
+    void HeadlessStrategy::run(f64 tickRate, f64 /*renderRate*/) {
+        RM_INFO("Running headless at %s", fastForward ? "full speed" : "the tick rate");
+
+        const f64 step = 1.0 / tickRate;
+        FramePacer pacer(tickRate);
+        pacer.start();
+        ticks = 0;
+        const u64 begin = Platform::getInstance().timeNS();
+        while (status == Status::Ok || status == Status::Pause) {
+            // Wait out paused time even when fast-forwarding, rather than spinning on the status
+            if (!fastForward || status == Status::Pause) {
+                pacer.wait();
+            }
+            if (status != Status::Ok) {
+                continue;
+            }
+
+            try {
+                RM_PROFILE_FRAME("Tick");
+                RM_PROFILE_SCOPE("Tick");
+                this->tick(step);
+            } catch (const Exception& e) {
+                RM_ERROR("%s", e.what());
+            }
+            if (++ticks == tickLimit) {
+                status = Status::Done;
+            }
+        }
+
+        const f64 seconds = static_cast<f64>(Platform::getInstance().timeNS() - begin) / 1e9;
+        ticksPerSecond = seconds > 0.0 ? static_cast<f64>(ticks) / seconds : 0.0;
+        RM_INFO("Headless run finished: %llu ticks in %.3fs (%.1f ticks/s)", static_cast<unsigned long long>(ticks), seconds, ticksPerSecond);
+    }
+}  // namespace rome::core
\ No newline at end of file
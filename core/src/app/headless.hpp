@@ -0,0 +1,50 @@
+#pragma once
+
+#include "app/strategy.hpp"
+#include "chrono/pacer.hpp"
+
+namespace rome::core {
+    class Application;
+
+    /**
+     * @brief An application strategy that only ticks, on the calling thread, for servers, replays and batch runs.
+     * Every tick gets the same fixed dt whether the loop is paced to the tick rate or fast-forwarding back-to-back, so
+     * a run is deterministic regardless of how fast the machine is.
+     */
+    class RM_API HeadlessStrategy : public ApplicationStrategy {
+        public:
+        /**
+         * @brief Creates a headless strategy.
+         * @param app The application to tick.
+         * @param fastForward Whether to tick back-to-back rather than at the tick rate (default is false).
+         * @param tickLimit The number of ticks after which the loop stops, 0 for no limit (default is 0).
+         */
+        HeadlessStrategy(Application& app, b8 fastForward = false, u64 tickLimit = 0);
+        ~HeadlessStrategy() override = default;
+
+        /**
+         * @brief Runs the tick loop until stopped or the tick limit is reached.
+         * @param tickRate The tick rate, which also sets the fixed dt.
+         * @param renderRate Unused, nothing is rendered.
+         */
+        void run(f64 tickRate, f64 renderRate) override;
+
+        /**
+         * @brief Gets the number of ticks run, as of the last run.
+         * @return The number of ticks.
+         */
+        inline u64 getTicks() const { return ticks; }
+
+        /**
+         * @brief Gets the achieved tick rate, as of the last run.
+         * @return The number of ticks per second of wall time.
+         */
+        inline f64 getTicksPerSecond() const { return ticksPerSecond; }
+
+        private:
+        b8 fastForward;            ///< Whether to tick back-to-back.
+        u64 tickLimit;             ///< The number of ticks after which to stop, 0 for no limit.
+        u64 ticks = 0;             ///< The number of ticks run.
+        f64 ticksPerSecond = 0.0;  ///< The achieved tick rate.
+    };
+}  // namespace rome::core
\ No newline at end of file
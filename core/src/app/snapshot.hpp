@@ -0,0 +1,72 @@
+#pragma once
+
+#include "app/app.hpp"
+#include "concurrency/triple_buffer.hpp"
+
+namespace rome::core {
+    /**
+     * @brief An application whose render thread draws from snapshots of the simulation rather than the live ECS.
+     * After every tick, capture() fills in the render-relevant state on the tick thread, which is published together
+     * with the previous tick's state through a wait-free triple buffer. Every frame then renders a consistent pair of
+     * consecutive states to blend by the interpolation factor, without locking or tearing.
+     * @tparam State The render-relevant state. Must be default constructible and copy assignable.
+     */
+    template <typename State>
+    class SnapshotApplication : public Application {
+        public:
+        using Application::Application;
+
+        /**
+         * @brief Captures the state after a tick and publishes it to the render thread.
+         */
+        void publish() final {
+            Frame& frame = frames.write();
+            frame.previous = latest;
+            capture(latest);
+            frame.latest = latest;
+            frames.publish();
+        }
+
+        void render(f64 dt) final { render(dt, 1.0); }
+
+        void render(f64 dt, f64 alpha) final {
+            const Frame& frame = frames.read();
+            render(dt, alpha, frame.previous, frame.latest);
+        }
+
+        /**
+         * @brief Gets the tick count of the snapshot last rendered.
+         * @return The number of ticks published up to that snapshot, 0 before the first tick.
+         * @warning Only the render thread may call this function.
+         */
+        inline u64 getSnapshotGeneration() const { return frames.getGeneration(); }
+
+        protected:
+        /**
+         * @brief Copies the render-relevant state out of the simulation. Runs on the tick thread after every tick.
+         * @param state The state to fill in, holding the previous tick's capture.
+         */
+        virtual void capture(State& state) = 0;
+
+        /**
+         * @brief Renders a frame from the two latest snapshots. Runs on the render thread.
+         * @param dt The time since the last frame.
+         * @param alpha How far past the latest tick the frame is, in [0, 1]. Blend previous into latest by it.
+         * @param previous The state captured one tick before latest.
+         * @param latest The state captured after the latest tick.
+         */
+        virtual void render(f64 dt, f64 alpha, const State& previous, const State& latest) = 0;
+
+        private:
+        /**
+         * @brief The states of two consecutive ticks.
+         */
+        struct Frame {
+            State previous{};  ///< The state one tick before latest.
+            State latest{};    ///< The state after the latest tick.
+        };
+
+        State latest{};              ///< The latest capture. Tick thread only.
+        TripleBuffer<Frame> frames;  ///< The frames handed to the render thread.
+    };
+}  // namespace rome::core
\ No newline at end of file
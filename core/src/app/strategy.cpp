@@ -4,7 +4,7 @@
 #include "debug/log.hpp"
 
 namespace rome::core {
-    ApplicationStrategy::ApplicationStrategy(const std::function<void(f64)>& tick, const std::function<void(f64)>& render)
+    ApplicationStrategy::ApplicationStrategy(const std::function<void(f64)>& tick, const std::function<void(f64, f64)>& render)
         : tick(tick), render(render), memoryMetrics(false) {}
 
     void ApplicationStrategy::start(f64 tickRate, f64 renderRate) {
@@ -13,10 +13,10 @@ namespace rome::core {
         public:
         /**
          * @brief Creates a new application strategy.
-         * @param tick The tick function.
-         * @param render The render function.
+         * @param tick The tick function, given the fixed time step.
+         * @param render The render function, given the frame time and the interpolation factor between the last two ticks.
          */
-        ApplicationStrategy(const std::function<void(f64)>& tick, const std::function<void(f64)>& render);
+        ApplicationStrategy(const std::function<void(f64)>& tick, const std::function<void(f64, f64)>& render);
         virtual ~ApplicationStrategy() = default;
 
         /**
@@ -55,8 +55,8 @@ namespace rome::core {
         };
         Status status = Status::Done;  ///< The status of the application loop.
 
-        const std::function<void(f64)> tick;    ///< The tick function.
-        const std::function<void(f64)> render;  ///< The render function;
+        const std::function<void(f64)> tick;         ///< The tick function.
+        const std::function<void(f64, f64)> render;  ///< The render function.
 
         b8 memoryMetrics;  ///< Whether to track memory usage.
     };
@@ -1,18 +1,33 @@
 #include "app/twin_threads.hpp"
 
 #include "app/app.hpp"
-#include "chrono/timer.hpp"
 #include "debug/exception.hpp"
+#include "debug/profiler.hpp"
+#include "memory/arena.hpp"
+#include "platform/platform.hpp"
 
 namespace rome::core {
-    TwinStrategy::TwinStrategy(Application& app, b8 memoryMetrics)
-        : ApplicationStrategy([this, &app](f64 dt) { app.tick(dt); }, [this, &app](f64 dt) { app.render(dt); }),
+    TwinStrategy::TwinStrategy(Application& app, b8 memoryMetrics, FramePacer::Mode pacing, u32 maxCatchUpTicks)
+        : ApplicationStrategy([this, &app](f64 dt) {
+                                  app.tick(dt);
+                                  app.publish();
+                                  FrameArena::endFrame(FrameArena::Phase::Tick);
+                              },
+                              [this, &app](f64 dt, f64 alpha) {
+                                  app.render(dt, alpha);
+                                  FrameArena::endFrame(FrameArena::Phase::Render);
+                              }),
           tickThread("Tick"),
-          renderThread("Render") {
+          renderThread("Render"),
+          pacing(pacing),
+          maxCatchUpTicks(std::max(maxCatchUpTicks, 1u)) {
         this->memoryMetrics = memoryMetrics;
     }
 
     void TwinStrategy::run(f64 tickRate, f64 renderRate) {
+        skippedTicks = 0;
+        stateTime.store(Platform::getInstance().timeNS(), std::memory_order_release);
+
         tickThread.run([this, &tickRate]() {
             RM_INFO("Starting up tick thread");
 
@@ -22,27 +37,42 @@ namespace rome::core {
                 RM_INFO("Metrics tracking ON for tick thread ID: %s", tickThread.getID().toString().c_str());
             }
 
-            f64 targetTime = 1.0 / tickRate;
-            f64 elapsed = 0.0;
-            Timer loopTimer;
-            loopTimer.start();
+            const f64 step = 1.0 / tickRate;
+            f64 accumulator = 0.0;
+            FramePacer pacer(tickRate, pacing);
+            pacer.start();
             while (status == Status::Ok || status == Status::Pause) {
-                elapsed += loopTimer.tick();
+                accumulator += pacer.wait();
+                const u64 now = Platform::getInstance().timeNS();
+                if (status != Status::Ok) {
+                    // Don't bank paused time, or resuming would start with a burst of catch-up ticks
+                    accumulator = 0.0;
+                    continue;
+                }
 
                 try {
-                    if (status == Status::Ok) {
-                        while (elapsed >= targetTime) {
-                            this->tick(elapsed);
-                            elapsed -= targetTime;
-                        }
+                    for (u32 ticks = 0; status == Status::Ok && accumulator >= step && ticks < maxCatchUpTicks; ticks++) {
+                        RM_PROFILE_FRAME("Tick");
+                        RM_PROFILE_SCOPE("Tick");
+                        this->tick(step);
+                        accumulator -= step;
                     }
                 } catch (const Exception& e) {
-                    RM_ERROR(e.what());
+                    RM_ERROR("%s", e.what());
+                }
+
+                // Drop whatever the cap left behind instead of spiralling further behind every frame
+                if (accumulator >= step) {
+                    const u64 skipped = static_cast<u64>(accumulator / step);
+                    skippedTicks += skipped;
+                    accumulator -= static_cast<f64>(skipped) * step;
                 }
+                stateTime.store(now - static_cast<u64>(accumulator * 1e9), std::memory_order_release);
             }
+            tickPacing = pacer.getStats();
         });
 
-        renderThread.run([this, &renderRate]() {
+        renderThread.run([this, &tickRate, &renderRate]() {
             RM_INFO("Starting up render thread");
 
             if (memoryMetrics) {
@@ -51,23 +81,35 @@ namespace rome::core {
                 RM_INFO("Metrics tracking ON for render thread ID: %s", renderThread.getID().toString().c_str());
             }
 
-            f64 targetTime = 1.0 / renderRate;
-            f64 elapsed = 0.0;
-            Timer loopTimer;
-            loopTimer.start();
+            FramePacer pacer(renderRate > 0.0 ? renderRate : tickRate, pacing);
+            pacer.start();
             while (status == Status::Ok || status == Status::Pause) {
-                elapsed += loopTimer.tick();
+                const f64 dt = pacer.wait();
+                const i64 sinceTick = static_cast<i64>(Platform::getInstance().timeNS() - stateTime.load(std::memory_order_acquire));
+                const f64 alpha = std::clamp(static_cast<f64>(sinceTick) * tickRate / 1e9, 0.0, 1.0);
 
-                if (elapsed >= targetTime) {
-                    this->render(elapsed);
-                    elapsed -= targetTime;
-                }
+                RM_PROFILE_FRAME("Render");
+                RM_PROFILE_SCOPE("Render");
+                this->render(dt, alpha);
             }
+            renderPacing = pacer.getStats();
         });
 
         tickThread.join();
         RM_INFO("Tick thread finished");
         renderThread.join();
         RM_INFO("Render thread finished");
+        logPacing("Tick", tickPacing);
+        logPacing("Render", renderPacing);
+        if (skippedTicks > 0) {
+            RM_WARN("Tick loop fell behind and skipped %llu ticks", static_cast<unsigned long long>(skippedTicks));
+        }
+    }
+
+    void TwinStrategy::logPacing(const char* loop, const FramePacer::Stats& stats) {
+        const f64 waited = stats.sleepTime + stats.spinTime;
+        RM_INFO("%s pacing: %llu frames, %llu missed, jitter mean %.1fus / stddev %.1fus / max %.1fus, slack %.1fus, %.0f%% of waiting asleep", loop,
+                static_cast<unsigned long long>(stats.frames), static_cast<unsigned long long>(stats.missed), stats.meanJitter * 1e6,
+                stats.stdDevJitter * 1e6, stats.maxJitter * 1e6, stats.slack * 1e6, waited > 0.0 ? 100.0 * stats.sleepTime / waited : 0.0);
     }
 }  // namespace rome::core
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "app/strategy.hpp"
+#include "chrono/pacer.hpp"
 #include "concurrency/thread.hpp"
 
 namespace rome::core {
@@ -11,18 +12,56 @@ namespace rome::core {
      */
     class RM_API TwinStrategy : public ApplicationStrategy {
         public:
-        TwinStrategy(Application& app, b8 memoryMetrics = true);
+        /**
+         * @brief Creates a twin-thread strategy.
+         * @param app The application to tick and render.
+         * @param memoryMetrics Whether to track memory usage on both threads (default is true).
+         * @param pacing How both loops wait for their next frame (default is Hybrid).
+         * @param maxCatchUpTicks The most ticks run per frame to catch up, time beyond that is dropped (default is 5).
+         */
+        TwinStrategy(Application& app, b8 memoryMetrics = true, FramePacer::Mode pacing = FramePacer::Mode::Hybrid, u32 maxCatchUpTicks = 5);
         ~TwinStrategy() override = default;
 
         /**
-         * @brief Runs the application loop.
+         * @brief Runs the application loop: fixed-step ticks on one thread, interpolated frames on the other.
          * @param tickRate The tick rate.
          * @param renderRate The render rate.
          */
         void run(f64 tickRate, f64 renderRate) override;
 
+        /**
+         * @brief Gets the pacing statistics of the tick loop, as of the last run.
+         * @return The statistics.
+         */
+        inline const FramePacer::Stats& getTickPacing() const { return tickPacing; }
+
+        /**
+         * @brief Gets the pacing statistics of the render loop, as of the last run.
+         * @return The statistics.
+         */
+        inline const FramePacer::Stats& getRenderPacing() const { return renderPacing; }
+
+        /**
+         * @brief Gets the number of ticks dropped because the tick loop fell more than maxCatchUpTicks behind.
+         * @return The number of skipped ticks, as of the last run.
+         */
+        inline u64 getSkippedTicks() const { return skippedTicks; }
+
         private:
-        Thread tickThread;    ///< The tick thread.
-        Thread renderThread;  ///< The render thread.
+        Thread tickThread;               ///< The tick thread.
+        Thread renderThread;             ///< The render thread.
+        FramePacer::Mode pacing;         ///< How both loops wait for their next frame.
+        FramePacer::Stats tickPacing;    ///< The pacing statistics of the tick loop.
+        FramePacer::Stats renderPacing;  ///< The pacing statistics of the render loop.
+        u32 maxCatchUpTicks;             ///< The most ticks run per frame.
+        u64 skippedTicks = 0;            ///< The number of ticks dropped by the catch-up cap.
+        std::atomic<u64> stateTime{0};   ///< When the latest tick's state is due, in nanoseconds. Drives interpolation.
+
+        /**
+         * @brief Logs the pacing statistics of a loop.
+         * @param loop The name of the loop.
+         * @param stats The statistics.
+         */
+        static void logPacing(const char* loop, const FramePacer::Stats& stats);
     };
 }  // namespace rome::core
\ No newline at end of file
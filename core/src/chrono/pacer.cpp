@@ -0,0 +1,83 @@
+#include "chrono/pacer.hpp"
+
+#include <cmath>
+
+#include "platform/platform.hpp"
+
+namespace rome::core {
+    FramePacer::FramePacer(f64 rate, Mode mode, f64 margin)
+        : mode(mode), margin(margin), period(rate > 0.0 ? static_cast<u64>(1e9 / rate) : 0), oversleep(static_cast<f64>(InitialSlackNS)), slack(InitialSlackNS) {}
+
+    void FramePacer::start() {
+        last = Platform::getInstance().timeNS();
+        deadline = last + period;
+    }
+
+    f64 FramePacer::wait() {
+        Platform platform = Platform::getInstance();
+        u64 now = platform.timeNS();
+
+        if (mode != Mode::Spin && deadline > now + (mode == Mode::Hybrid ? slack : 0)) {
+            const u64 target = mode == Mode::Hybrid ? deadline - slack : deadline;
+            platform.sleepUntilNS(target);
+            const u64 woke = platform.timeNS();
+            calibrate(woke > target ? woke - target : 0);
+            stats.sleepTime += static_cast<f64>(woke - now);
+            now = woke;
+        }
+        const u64 spun = now;
+        while (now < deadline) {
+            now = platform.timeNS();
+        }
+        stats.spinTime += static_cast<f64>(now - spun);
+
+        const f64 jitter = static_cast<f64>(now - deadline);
+        stats.frames++;
+        stats.meanJitter += jitter;
+        stats.maxJitter = std::max(stats.maxJitter, jitter);
+        jitterSquares += jitter * jitter;
+
+        // Resync rather than burst through every deadline that was missed
+        deadline += period;
+        if (deadline <= now) {
+            stats.missed++;
+            deadline = now + period;
+        }
+        const f64 elapsed = static_cast<f64>(now - last) / 1e9;
+        last = now;
+        return elapsed;
+    }
+
+    void FramePacer::setRate(f64 rate) {
+        const u64 next = rate > 0.0 ? static_cast<u64>(1e9 / rate) : 0;
+        deadline = deadline - period + next;
+        period = next;
+    }
+
+    FramePacer::Stats FramePacer::getStats() const {
+        Stats result = stats;
+        const f64 frames = static_cast<f64>(std::max<u64>(stats.frames, 1));
+        const f64 mean = stats.meanJitter / frames;
+        result.meanJitter = mean / 1e9;
+        result.stdDevJitter = std::sqrt(std::max(jitterSquares / frames - mean * mean, 0.0)) / 1e9;
+        result.maxJitter = stats.maxJitter / 1e9;
+        result.slack = static_cast<f64>(slack) / 1e9;
+        result.sleepTime = stats.sleepTime / 1e9;
+        result.spinTime = stats.spinTime / 1e9;
+        return result;
+    }
+
+    void FramePacer::resetStats() {
+        stats = Stats{};
+        jitterSquares = 0.0;
+    }
+
+    void FramePacer::calibrate(u64 observed) {
+        // Smoothed mean and mean deviation of the oversleep, in the style of TCP's retransmission timer
+        const f64 error = static_cast<f64>(observed) - oversleep;
+        oversleep += error / 8.0;
+        deviation += (std::abs(error) - deviation) / 4.0;
+        const f64 estimate = oversleep + margin * deviation;
+        slack = std::clamp(static_cast<u64>(estimate), MinSlackNS, std::max(period / 2, MinSlackNS));
+    }
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief Paces a loop to a target rate without burning a core.
+     * The pacer sleeps until shortly before each deadline, then spins for the remaining microseconds. The wake-up slack
+     * is calibrated from how late the OS actually wakes the thread, so spinning stays as short as the platform allows.
+     */
+    class RM_API FramePacer final {
+        public:
+        /**
+         * @brief How the pacer waits for a deadline, trading CPU time for timing precision.
+         */
+        enum class Mode : u8 {
+            Spin,    ///< Busy-wait for the whole frame. Most precise, costs a full core.
+            Hybrid,  ///< Sleep until the calibrated slack before the deadline, then spin.
+            Sleep    ///< Only sleep. Cheapest, late by the OS wake-up latency.
+        };
+
+        /**
+         * @brief Timing statistics since the pacer started or the stats were reset.
+         */
+        struct Stats {
+            u64 frames = 0;          ///< The number of deadlines waited for.
+            u64 missed = 0;          ///< The number of deadlines already a full period behind, after which the pacer resynced.
+            f64 meanJitter = 0.0;    ///< The mean lateness of a wake-up past its deadline (in seconds).
+            f64 stdDevJitter = 0.0;  ///< The standard deviation of the lateness (in seconds).
+            f64 maxJitter = 0.0;     ///< The worst lateness (in seconds).
+            f64 slack = 0.0;         ///< The current wake-up slack estimate (in seconds).
+            f64 sleepTime = 0.0;     ///< The total time spent asleep (in seconds).
+            f64 spinTime = 0.0;      ///< The total time spent spinning (in seconds).
+        };
+
+        static constexpr u64 InitialSlackNS = 1000000;  ///< The slack assumed before any calibration.
+        static constexpr u64 MinSlackNS = 50000;        ///< The smallest slack the calibration settles on.
+
+        /**
+         * @brief Creates a frame pacer.
+         * @param rate The target rate (in Hz). A rate of 0 never waits.
+         * @param mode How to wait for deadlines (default is Hybrid).
+         * @param margin How many deviations of the measured oversleep to add to its mean when calibrating the slack.
+         *        Higher values spin longer but miss fewer deadlines (default is 4).
+         */
+        explicit FramePacer(f64 rate, Mode mode = Mode::Hybrid, f64 margin = 4.0);
+        ~FramePacer() = default;
+
+        /**
+         * @brief Starts pacing, the first deadline being one period from now.
+         */
+        void start();
+
+        /**
+         * @brief Blocks until the next deadline.
+         * @return The time elapsed since the previous call returned, or since start() (in seconds).
+         */
+        f64 wait();
+
+        /**
+         * @brief Changes the target rate, effective from the next deadline.
+         * @param rate The target rate (in Hz).
+         */
+        void setRate(f64 rate);
+
+        /**
+         * @brief Gets the timing statistics.
+         * @return The statistics.
+         */
+        Stats getStats() const;
+
+        /**
+         * @brief Resets the timing statistics, keeping the slack calibration.
+         */
+        void resetStats();
+
+        /**
+         * @brief Gets the mode of the pacer.
+         * @return The mode.
+         */
+        inline Mode getMode() const { return mode; }
+
+        private:
+        Mode mode;                ///< How to wait for deadlines.
+        f64 margin;               ///< The deviations of oversleep added to the slack.
+        u64 period;               ///< The target period (in nanoseconds).
+        u64 deadline = 0;         ///< The next deadline (in nanoseconds).
+        u64 last = 0;             ///< When wait() last returned (in nanoseconds).
+        f64 oversleep;            ///< The smoothed mean oversleep (in nanoseconds).
+        f64 deviation = 0.0;      ///< The smoothed mean deviation of the oversleep (in nanoseconds).
+        u64 slack;                ///< The current slack (in nanoseconds).
+        Stats stats;              ///< The statistics, jitter sums kept in nanoseconds until read.
+        f64 jitterSquares = 0.0;  ///< The sum of squared lateness (in nanoseconds squared).
+
+        /**
+         * @brief Folds an observed oversleep into the slack estimate.
+         * @param observed How late the OS woke the thread (in nanoseconds).
+         */
+        void calibrate(u64 observed);
+    };
+}  // namespace rome::core
\ No newline at end of file
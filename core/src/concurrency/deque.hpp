@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief A Chase-Lev work-stealing deque.
+     * The owning thread pushes and pops at the bottom without contention, while any other thread may steal from the top.
+     * The ring grows on demand; retired rings are kept alive until the deque is destroyed, since a thief may still read them.
+     * @tparam T The type of the stored items. Must be trivially copyable, typically a pointer.
+     * @note push() and pop() must only be called by the owning thread. steal() is thread-safe.
+     */
+    template <typename T>
+    class RM_API WorkStealingDeque final {
+        STATIC_ASSERT(std::is_trivially_copyable_v<T>, "Work-stealing deque items must be trivially copyable");
+
+        public:
+        /**
+         * @brief Creates a deque.
+         * @param capacity The initial capacity, must be a power of two (default is 256).
+         */
+        explicit WorkStealingDeque(u64 capacity = 256) {
+            RM_ASSERT_MSG(capacity > 0 && (capacity & (capacity - 1)) == 0, "Deque capacity must be a power of two");
+            rings.push_back(MakeUnique<Ring>(capacity));
+            ring.store(rings.back().get(), std::memory_order_relaxed);
+        }
+        ~WorkStealingDeque() = default;
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+        WorkStealingDeque(WorkStealingDeque&&) = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+        /**
+         * @brief Pushes an item at the bottom of the deque.
+         * @param item The item to push.
+         * @warning Only the owning thread may call this function.
+         */
+        void push(T item) {
+            const i64 b = bottom.load(std::memory_order_relaxed);
+            const i64 t = top.load(std::memory_order_acquire);
+            Ring* current = ring.load(std::memory_order_relaxed);
+            if (b - t >= static_cast<i64>(current->capacity)) {
+                current = grow(current, t, b);
+            }
+            current->put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Pops the most recently pushed item.
+         * @param item Receives the popped item.
+         * @return True if an item was popped, false if the deque was empty or the last item was stolen.
+         * @warning Only the owning thread may call this function.
+         */
+        b8 pop(T& item) {
+            const i64 b = bottom.load(std::memory_order_relaxed) - 1;
+            Ring* current = ring.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            i64 t = top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+            item = current->get(b);
+            if (t == b) {
+                // Last item: race the thieves for it
+                const b8 won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Steals the oldest item.
+         * @param item Receives the stolen item.
+         * @return True if an item was stolen, false if the deque was empty or another thread won the race.
+         * @note This function is thread-safe.
+         */
+        b8 steal(T& item) {
+            i64 t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const i64 b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return false;
+            }
+            item = ring.load(std::memory_order_acquire)->get(t);
+            return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Estimates the number of items in the deque.
+         * @return The number of items, possibly stale by the time it is read.
+         */
+        inline u64 getSize() const noexcept {
+            const i64 b = bottom.load(std::memory_order_relaxed);
+            const i64 t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<u64>(b - t) : 0;
+        }
+
+        /**
+         * @brief Gets the capacity of the current ring.
+         * @return The number of items the deque can hold before growing.
+         */
+        inline u64 getCapacity() const noexcept { return ring.load(std::memory_order_relaxed)->capacity; }
+
+        private:
+        /**
+         * @brief A power-of-two circular buffer indexed by the ever-increasing top / bottom positions.
+         */
+        struct Ring {
+            const u64 capacity;              ///< The number of slots.
+            Unique<std::atomic<T>[]> slots;  ///< The slots, atomic so thieves may read them while the owner writes.
+
+            explicit Ring(u64 capacity) : capacity(capacity), slots(new std::atomic<T>[capacity]) {}
+
+            inline void put(i64 index, T item) noexcept { slots[index & (capacity - 1)].store(item, std::memory_order_relaxed); }
+            inline T get(i64 index) const noexcept { return slots[index & (capacity - 1)].load(std::memory_order_relaxed); }
+        };
+
+        alignas(64) std::atomic<i64> top{0};     ///< The next position to steal from.
+        alignas(64) std::atomic<i64> bottom{0};  ///< The next position to push to.
+        std::atomic<Ring*> ring;                 ///< The current ring.
+        std::vector<Unique<Ring>> rings;         ///< Every ring allocated so far, the last one being current.
+
+        /**
+         * @brief Replaces the ring with one twice as large, copying the live items.
+         * @param current The current ring.
+         * @param t The top position.
+         * @param b The bottom position.
+         * @return The new ring.
+         */
+        Ring* grow(Ring* current, i64 t, i64 b) {
+            rings.push_back(MakeUnique<Ring>(current->capacity * 2));
+            Ring* next = rings.back().get();
+            for (i64 i = t; i < b; i++) {
+                next->put(i, current->get(i));
+            }
+            ring.store(next, std::memory_order_release);
+            return next;
+        }
+    };
+}  // namespace rome::core
\ No newline at end of file
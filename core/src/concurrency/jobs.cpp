@@ -0,0 +1,200 @@
+#include "concurrency/jobs.hpp"
+
+#include "debug/log.hpp"
+#include "debug/metrics.hpp"
+
+static thread_local const rome::core::JobSystem* localSystem = nullptr;  ///< The job system the current thread works for.
+static thread_local rome::u32 localWorker = 0;                          ///< The worker index of the current thread.
+
+namespace rome::core {
+    JobSystem::JobSystem(u32 size, const std::string& alias, b8 memoryMetrics) : memoryMetrics(memoryMetrics) {
+        size = std::max(size, 1u);
+        workers.reserve(size);
+        for (u32 i = 0; i < size; i++) {
+            workers.push_back(MakeUnique<Worker>());
+            workers.back()->thread = MakeUnique<Thread>(alias + " " + std::to_string(i));
+        }
+        // Start only once every deque exists, since workers steal from each other right away
+        for (u32 i = 0; i < size; i++) {
+            workers[i]->thread->run([this, i]() { work(i); });
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard guard(sleepLock);
+            stopping.store(true);
+        }
+        wake.notify_all();
+        for (Unique<Worker>& worker : workers) {
+            worker->thread->join();
+        }
+
+        Job* job;
+        for (Unique<Worker>& worker : workers) {
+            while (worker->deque.pop(job)) {
+                delete job;
+            }
+        }
+        for (Job* leftover : injected) {
+            delete leftover;
+        }
+    }
+
+    void JobSystem::submit(std::function<void()> function, Counter* counter, Counter* after) {
+        if (counter) {
+            counter->pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        Job* job = new Job{std::move(function), counter};
+
+        if (after) {
+            std::lock_guard guard(after->lock);
+            if (after->pending.load(std::memory_order_acquire) != 0) {
+                after->waiting.push_back(job);
+                return;
+            }
+        }
+        schedule(job);
+    }
+
+    void JobSystem::wait(Counter& counter) {
+        while (!counter.isDone()) {
+            if (Job* job = find()) {
+                execute(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        // The last job may still be releasing continuations under the lock
+        std::exception_ptr error;
+        {
+            std::lock_guard guard(counter.lock);
+            error = counter.error;
+            counter.error = nullptr;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    u32 JobSystem::getDefaultSize() noexcept { return std::max(std::thread::hardware_concurrency(), 2u) - 1; }
+
+    JobSystem& JobSystem::getInstance() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    void JobSystem::schedule(Job* job) {
+        if (localSystem == this) {
+            workers[localWorker]->deque.push(job);
+        } else {
+            std::lock_guard guard(injectedLock);
+            injected.push_back(job);
+        }
+
+        epoch.fetch_add(1);
+        if (sleepers.load() > 0) {
+            { std::lock_guard guard(sleepLock); }
+            wake.notify_one();
+        }
+    }
+
+    JobSystem::Job* JobSystem::find() {
+        Job* job = nullptr;
+        const b8 isWorker = localSystem == this;
+        if (isWorker && workers[localWorker]->deque.pop(job)) {
+            return job;
+        }
+
+        {
+            std::lock_guard guard(injectedLock);
+            if (!injected.empty()) {
+                job = injected.front();
+                injected.pop_front();
+                return job;
+            }
+        }
+
+        const u32 start = isWorker ? localWorker + 1 : 0;
+        for (u32 i = 0; i < workers.size(); i++) {
+            const u32 victim = (start + i) % workers.size();
+            if ((!isWorker || victim != localWorker) && workers[victim]->deque.steal(job)) {
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::execute(Job* job) {
+        std::exception_ptr error;
+        try {
+            job->function();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        Counter* counter = job->counter;
+        delete job;
+        if (!counter) {
+            if (error) {
+                try {
+                    std::rethrow_exception(error);
+                } catch (const std::exception& e) {
+                    RM_ERROR("Job failed on %s: %s", ThreadInfo::getLocalAlias().c_str(), e.what());
+                } catch (...) {
+                    RM_ERROR("Job failed on %s", ThreadInfo::getLocalAlias().c_str());
+                }
+            }
+            return;
+        }
+
+        std::vector<Job*> released;
+        {
+            std::lock_guard guard(counter->lock);
+            if (error && !counter->error) {
+                counter->error = error;
+            }
+            if (counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                released.swap(counter->waiting);
+            }
+        }
+        for (Job* next : released) {
+            schedule(next);
+        }
+    }
+
+    void JobSystem::work(u32 index) {
+        localSystem = this;
+        localWorker = index;
+        if (memoryMetrics) {
+            Metrics::getInstance().registerThread(ThreadInfo::getLocalAlias());
+            Metrics::getInstance().setIsMemoryTracking(true);
+        }
+
+        while (true) {
+            if (Job* job = find()) {
+                execute(job);
+                continue;
+            }
+
+            const u64 seen = epoch.load();
+            if (Job* job = find()) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock guard(sleepLock);
+            if (stopping.load()) {
+                break;
+            }
+            sleepers.fetch_add(1);
+            wake.wait(guard, [this, seen]() { return stopping.load() || epoch.load() != seen; });
+            sleepers.fetch_sub(1);
+        }
+
+        if (memoryMetrics) {
+            Metrics::getInstance().unregisterThread();
+        }
+        localSystem = nullptr;
+    }
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+#include "concurrency/deque.hpp"
+#include "concurrency/thread.hpp"
+
+namespace rome::core {
+    /**
+     * @brief A work-stealing job system: every worker owns a Chase-Lev deque and steals from the others when it runs dry.
+     * Jobs submitted from outside the workers go through a shared injection queue. Waiting on a counter never blocks
+     * a thread that could be running jobs: the waiter keeps executing pending jobs until the counter drops to zero.
+     * @note Workers are Threads aliased "<alias> <n>", so logs and metrics attribute their work correctly.
+     */
+    class RM_API JobSystem final {
+        struct Job;
+
+        public:
+        /**
+         * @brief Counts the unfinished jobs of a batch, and holds the jobs waiting for the batch to finish.
+         * The first exception thrown by a counted job is kept, and rethrown by the next wait() on the counter.
+         * @note A counter must outlive the jobs it counts and any wait() on it.
+         */
+        class RM_API Counter final {
+            public:
+            Counter() = default;
+            ~Counter() = default;
+            Counter(const Counter&) = delete;
+            Counter& operator=(const Counter&) = delete;
+            Counter(Counter&&) = delete;
+            Counter& operator=(Counter&&) = delete;
+
+            /**
+             * @brief Gets the number of unfinished jobs.
+             * @return The number of jobs submitted with this counter that have not finished yet.
+             * @note This function is thread-safe.
+             */
+            inline u64 getPending() const noexcept { return pending.load(std::memory_order_acquire); }
+
+            /**
+             * @brief Checks whether every counted job has finished.
+             * @return True if no job is pending, false otherwise.
+             * @note This function is thread-safe.
+             */
+            inline b8 isDone() const noexcept { return getPending() == 0; }
+
+            private:
+            friend class JobSystem;
+
+            std::atomic<u64> pending{0};  ///< The number of unfinished jobs.
+            std::mutex lock;              ///< Guards the continuations, the error and the final decrement.
+            std::vector<Job*> waiting;    ///< Jobs released once pending drops to zero.
+            std::exception_ptr error;     ///< The first exception thrown by a counted job, null if none.
+        };
+
+        /**
+         * @brief Starts the worker threads.
+         * @param size The number of workers, at least one.
+         * @param alias The alias prefix of the workers.
+         * @param memoryMetrics Whether the workers register with Metrics and track their allocations.
+         */
+        explicit JobSystem(u32 size = getDefaultSize(), const std::string& alias = "Worker", b8 memoryMetrics = false);
+        ~JobSystem();
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        JobSystem(JobSystem&&) = delete;
+        JobSystem& operator=(JobSystem&&) = delete;
+
+        /**
+         * @brief Queues a job.
+         * @param function The job to run.
+         * @param counter Incremented now and decremented once the job finishes, may be null.
+         * @param after The job only starts once this counter is done, may be null.
+         * @note This function is thread-safe. Jobs submitted from a worker go to that worker's own deque.
+         */
+        void submit(std::function<void()> function, Counter* counter = nullptr, Counter* after = nullptr);
+
+        /**
+         * @brief Runs pending jobs on the calling thread until every job counted by a counter has finished.
+         * @param counter The counter to wait on.
+         * @throws The first exception thrown by a counted job, once every counted job has finished.
+         * @note This function is thread-safe, and may be called from inside a job.
+         */
+        void wait(Counter& counter);
+
+        /**
+         * @brief Splits a range into batches and processes them in parallel, returning once every batch is done.
+         * @tparam Function The type of the function, invocable with (u64 first, u64 last).
+         * @param first The first index of the range.
+         * @param last One past the last index of the range.
+         * @param function Called once per batch with its half-open sub-range.
+         * @param grain The number of indices per batch, or 0 to aim for a few batches per worker.
+         * @throws The first exception thrown by a batch, once every batch has finished.
+         * @note The calling thread processes batches too.
+         */
+        template <typename Function>
+        void parallelFor(u64 first, u64 last, Function&& function, u64 grain = 0) {
+            if (first >= last) {
+                return;
+            }
+            const u64 count = last - first;
+            if (grain == 0) {
+                grain = getGrain(count);
+            }
+            if (count <= grain) {
+                function(first, last);
+                return;
+            }
+
+            Counter counter;
+            for (u64 begin = first + grain; begin < last; begin += grain) {
+                submit([&function, begin, end = std::min(begin + grain, last)]() { function(begin, end); }, &counter);
+            }
+            try {
+                function(first, first + grain);
+            } catch (...) {
+                wait(counter);
+                throw;
+            }
+            wait(counter);
+        }
+
+        /**
+         * @brief Gets the batch size parallelFor picks for a range when it is given no grain.
+         * @param count The number of indices in the range.
+         * @return The number of indices per batch, aiming for a few batches per worker.
+         */
+        inline u64 getGrain(u64 count) const noexcept { return std::max<u64>(count / ((getSize() + 1) * GrainSplit), 1); }
+
+        /**
+         * @brief Gets the number of workers.
+         * @return The number of worker threads.
+         */
+        inline u32 getSize() const noexcept { return static_cast<u32>(workers.size()); }
+
+        /**
+         * @brief Gets the default number of workers: one per hardware thread, minus the calling thread.
+         * @return The default number of workers.
+         */
+        static u32 getDefaultSize() noexcept;
+
+        /**
+         * @brief Gets the shared job system, started with the default number of workers on first use.
+         * @return The shared job system.
+         */
+        static JobSystem& getInstance();
+
+        private:
+        static constexpr u64 GrainSplit = 4;  ///< Automatic grain sizing aims for this many batches per thread.
+
+        /**
+         * @brief A queued job.
+         */
+        struct Job {
+            std::function<void()> function;  ///< The job to run.
+            Counter* counter;                ///< Decremented once the job finishes, may be null.
+        };
+
+        /**
+         * @brief A worker thread and the deque it owns.
+         */
+        struct Worker {
+            WorkStealingDeque<Job*> deque;  ///< Jobs pushed by this worker.
+            Unique<Thread> thread;          ///< The worker thread.
+        };
+
+        std::vector<Unique<Worker>> workers;  ///< The workers.
+        std::mutex injectedLock;              ///< Guards the injection queue.
+        std::deque<Job*> injected;            ///< Jobs submitted from outside the workers.
+        std::mutex sleepLock;                 ///< Guards sleeping workers.
+        std::condition_variable wake;         ///< Signalled when work arrives or the system stops.
+        std::atomic<u64> epoch{0};            ///< Bumped every time a job becomes runnable.
+        std::atomic<u32> sleepers{0};         ///< The number of workers waiting for work.
+        std::atomic<b8> stopping{false};      ///< Whether the workers should exit.
+        const b8 memoryMetrics;               ///< Whether the workers track their allocations.
+
+        /**
+         * @brief Makes a job runnable: pushed to the calling worker's deque, or injected, then wakes a worker.
+         * @param job The job.
+         */
+        void schedule(Job* job);
+
+        /**
+         * @brief Finds a runnable job: the calling worker's own deque first, then the injection queue, then stealing.
+         * @return A job, or null if none was found.
+         */
+        Job* find();
+
+        /**
+         * @brief Runs a job, then releases its counter and the jobs waiting on it, whether the job threw or not.
+         * An exception thrown by the job is kept on its counter, or logged if it has none.
+         * @param job The job, deleted once done.
+         */
+        void execute(Job* job);
+
+        /**
+         * @brief The worker loop.
+         * @param index The index of the worker.
+         */
+        void work(u32 index);
+    };
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief A wait-free triple buffer handing the latest value from one writer thread to one reader thread.
+     * The writer fills the back slot and publishes it by swapping it with the middle slot; the reader swaps the middle
+     * slot into the front when something new was published. Both sides only ever exchange a single atomic byte, so
+     * neither can block or tear the other, and the reader always sees a complete value. Values the reader did not get
+     * to before a newer one was published are skipped.
+     * @tparam T The type of the value. Slots are reused, so the writer should overwrite every field it cares about.
+     * @note write() / publish() must only be called by the writer thread, read() / getGeneration() by the reader thread.
+     */
+    template <typename T>
+    class RM_API TripleBuffer final {
+        public:
+        TripleBuffer() = default;
+        /**
+         * @brief Creates a triple buffer with every slot holding a copy of a value.
+         * @param initial The value to start from.
+         */
+        explicit TripleBuffer(const T& initial) : slots{{initial}, {initial}, {initial}} {}
+        ~TripleBuffer() = default;
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+        TripleBuffer(TripleBuffer&&) = delete;
+        TripleBuffer& operator=(TripleBuffer&&) = delete;
+
+        /**
+         * @brief Gets the back slot to fill before publishing it.
+         * @return The back slot, holding whatever value was last published from it.
+         * @warning Only the writer thread may call this function.
+         */
+        inline T& write() noexcept { return slots[back].value; }
+
+        /**
+         * @brief Publishes the back slot as the latest value, and takes over a free slot as the new back slot.
+         * @warning Only the writer thread may call this function.
+         */
+        void publish() noexcept {
+            slots[back].generation = ++published;
+            back = middle.exchange(back | Dirty, std::memory_order_acq_rel) & Index;
+        }
+
+        /**
+         * @brief Gets the latest published value.
+         * @return The latest value, or the initial value if nothing was published yet. Stays valid and unchanged until
+         *         the next call.
+         * @warning Only the reader thread may call this function.
+         */
+        const T& read() noexcept {
+            if (middle.load(std::memory_order_relaxed) & Dirty) {
+                front = middle.exchange(front, std::memory_order_acq_rel) & Index;
+            }
+            return slots[front].value;
+        }
+
+        /**
+         * @brief Checks whether a value was published since the reader last read.
+         * @return True if read() would return a newer value, false otherwise.
+         */
+        inline b8 isUpdated() const noexcept { return middle.load(std::memory_order_acquire) & Dirty; }
+
+        /**
+         * @brief Gets the generation of the value last returned by read(), counting publications from 1.
+         * @return The generation, 0 if nothing was read yet. Gaps mean values were skipped.
+         * @warning Only the reader thread may call this function.
+         */
+        inline u64 getGeneration() const noexcept { return slots[front].generation; }
+
+        private:
+        static constexpr u8 Index = 0b011;  ///< The bits of the middle state holding a slot index.
+        static constexpr u8 Dirty = 0b100;  ///< The bit of the middle state set when the middle slot is unread.
+
+        /**
+         * @brief A value and the publication it came from, on its own cache line.
+         */
+        struct alignas(64) Slot {
+            T value{};           ///< The value.
+            u64 generation = 0;  ///< The publication that filled the slot, 0 if never published.
+        };
+
+        Slot slots[3];                          ///< The back, middle and front slots, in no fixed order.
+        alignas(64) std::atomic<u8> middle{1};  ///< The middle slot index, plus the dirty bit.
+        alignas(64) u8 back = 0;                ///< The back slot index. Writer only.
+        u64 published = 0;                      ///< The number of publications so far. Writer only.
+        alignas(64) u8 front = 2;               ///< The front slot index. Reader only.
+    };
+}  // namespace rome::core
\ No newline at end of file
@@ -113,10 +113,13 @@ namespace rome::core {
 
         /**
          * @brief Tests whether a specific bit is set.
-         * @param bit The bit index to test.
+         * @param bit The bit index to test. Bits past the current storage read as unset.
          * @return True if the bit is set, false otherwise.
          */
-        b8 test(Alias bit) const noexcept { return (*locate(static_cast<u64>(bit)) & (1ull << (static_cast<u64>(bit) & 63))) != 0; }
+        b8 test(Alias bit) const noexcept {
+            if (static_cast<u64>(bit) >= words() * 64) return false;
+            return (*locate(static_cast<u64>(bit)) & (1ull << (static_cast<u64>(bit) & 63))) != 0;
+        }
 
         /**
          * @brief Sets a bit to true.
@@ -197,14 +200,40 @@ namespace rome::core {
          * @return True if there is at least one bit set in both bitsets, false otherwise.
          */
         b8 intersects(const BitSet& other) const noexcept {
-            if (words() != other.words()) return false;
-
-            for (u64 i = 0; i < words(); i++) {
+            // Words past the shorter bitset are implicitly zero on its side
+            for (u64 i = 0; i < std::min(words(), other.words()); i++) {
                 if (at(i) & other.at(i)) return true;
             }
             return false;
         }
 
+        /**
+         * @brief Checks whether every bit set in another bitset is also set in this one.
+         * @param other The bitset whose bits must all be set, e.g. a mask of required components.
+         * @return True if this bitset is a superset of the other, false otherwise.
+         */
+        b8 includes(const BitSet& other) const noexcept {
+            for (u64 i = 0; i < other.words(); i++) {
+                const u64 word = i < words() ? at(i) : 0;
+                if (other.at(i) & ~word) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Calls a function for every set bit, in ascending order.
+         * @tparam Function The type of the function, invocable with (Alias).
+         * @param function The function to call.
+         */
+        template <typename Function>
+        void each(Function&& function) const {
+            for (u64 i = 0; i < words(); i++) {
+                for (u64 word = at(i); word; word &= word - 1) {
+                    function(static_cast<Alias>(i * 64 + std::countr_zero(word)));
+                }
+            }
+        }
+
         private:
         std::array<u64, Size / 64> direct{};  ///< Stack storage for the first Size bits.
         std::vector<u64> spill;               ///< Dynamic storage for bits beyond Size.
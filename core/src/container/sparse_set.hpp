@@ -1,16 +1,49 @@
 #pragma once
 
+#include <limits>
+#include <memory_resource>
+
 #include "debug/exception.hpp"
 
 namespace rome::core {
-    template <typename T>
+    /**
+     * @brief A sparse set mapping (possibly very large) indices to densely packed values.
+     * The sparse array is split into fixed-size pages that are only allocated once an index inside them is used,
+     * so a single high index does not allocate memory for every index below it.
+     * @tparam T The type of the stored values.
+     * @tparam Index The type used to store dense positions in the sparse pages. Must be an unsigned integer type no larger than 64 bits.
+     *               Use u32 to halve the sparse footprint when the set will never hold more than 2^32 - 1 values (default is u64).
+     * @tparam PageSize The number of sparse slots per page, must be a power of two (default is 4096).
+     *                  The page table itself stays flat, one entry of sizeof(Page) (16 bytes) per page up to the highest
+     *                  index used: an index near 2^32 costs a 16 MiB table with the default size. Use a larger page for
+     *                  sets keyed by such indices.
+     * @note The dense arrays allocate from a std::pmr::memory_resource, e.g. a SlabPool. The sparse pages always use the heap.
+     */
+    template <typename T, typename Index = u64, u64 PageSize = 4096>
     class RM_API SparseSet final {
+        STATIC_ASSERT(std::is_unsigned_v<Index>, "Index must be an unsigned integer type");
+        STATIC_ASSERT(sizeof(Index) <= 8, "Index must be no larger than 64 bits");
+        STATIC_ASSERT(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
         public:
         SparseSet() : size(0) {};
+        /**
+         * @brief Creates a sparse set whose dense arrays allocate from the given resource.
+         * @param resource The resource to allocate the dense arrays from. Must outlive the set.
+         */
+        explicit SparseSet(std::pmr::memory_resource* resource) : dense(resource), data(resource), size(0) {}
         ~SparseSet() = default;
-        SparseSet(const SparseSet& other) = default;
+        SparseSet(const SparseSet& other) : dense(other.dense), data(other.data), size(other.size) { copyPages(other); }
         SparseSet(SparseSet&& other) = default;
-        SparseSet& operator=(const SparseSet& other) = default;
+        SparseSet& operator=(const SparseSet& other) {
+            if (this != &other) {
+                dense = other.dense;
+                data = other.data;
+                size = other.size;
+                copyPages(other);
+            }
+            return *this;
+        }
         SparseSet& operator=(SparseSet&& other) = default;
 
         /**
@@ -22,14 +55,7 @@ namespace rome::core {
             if (contains(index)) {
                 return;
             }
-            if (index >= sparse.size()) {
-                sparse.resize(index + 1, 0);
-            }
-            if (size >= dense.size()) {
-                dense.resize(size + 1, 0);
-            }
-            dense[size] = index;
-            sparse[index] = size;
+            bind(index);
             data.push_back(value);
             size++;
         }
@@ -43,14 +69,7 @@ namespace rome::core {
             if (contains(index)) {
                 return;
             }
-            if (index >= sparse.size()) {
-                sparse.resize(index + 1, 0);
-            }
-            if (size >= dense.size()) {
-                dense.resize(size + 1, 0);
-            }
-            dense[size] = index;
-            sparse[index] = size;
+            bind(index);
             data.emplace_back(std::move(value));
             size++;
         }
@@ -66,14 +85,7 @@ namespace rome::core {
             if (contains(index)) {
                 return;
             }
-            if (index >= sparse.size()) {
-                sparse.resize(index + 1, 0);
-            }
-            if (size >= dense.size()) {
-                dense.resize(size + 1, 0);
-            }
-            dense[size] = index;
-            sparse[index] = size;
+            bind(index);
             data.emplace_back(std::forward<Args>(args)...);
             size++;
         }
@@ -81,17 +93,24 @@ namespace rome::core {
         /**
          * @brief Removes an element from the sparse set.
          * @param index The index of the element to remove.
+         * @note The page holding the index is released once it no longer maps any element.
          */
         void erase(u64 index) {
             if (!contains(index)) {
                 return;
             }
-            sparse[dense[size - 1]] = sparse[index];
-            std::swap(dense[sparse[index]], dense[size - 1]);
-            std::swap(data[sparse[index]], data[size - 1]);
+            const Index position = slot(index);
+            slot(dense[size - 1]) = position;
+            std::swap(dense[position], dense[size - 1]);
+            std::swap(data[position], data[size - 1]);
             dense.pop_back();
             data.pop_back();
             size--;
+
+            Page& page = pages[index / PageSize];
+            if (--page.live == 0) {
+                page.slots.reset();
+            }
         }
 
         /**
@@ -103,12 +122,12 @@ namespace rome::core {
             if (index1 == index2 || !contains(index1) || !contains(index2)) {
                 return;
             }
-            u64 pos1 = sparse[index1];
-            u64 pos2 = sparse[index2];
+            Index& pos1 = slot(index1);
+            Index& pos2 = slot(index2);
 
             std::swap(dense[pos1], dense[pos2]);
-            std::swap(sparse[index1], sparse[index2]);
             std::swap(data[pos1], data[pos2]);
+            std::swap(pos1, pos2);
         }
 
         /**
@@ -118,6 +137,13 @@ namespace rome::core {
          */
         std::pair<T*, u64> getData() { return {data.data(), size}; }
 
+        /**
+         * @brief Fetches the sparse indices of the stored values, in the same order as the data.
+         * @return A span over the sparse index of every stored value.
+         * @warning The span is only valid as long as the sparse set's size does not change.
+         */
+        std::span<const u64> getIndices() const noexcept { return {dense.data(), size}; }
+
         /**
          * @brief Gets the value at the given index.
          * @param index The index to get the value from.
@@ -127,7 +153,7 @@ namespace rome::core {
             if (!contains(index)) {
                 THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Sparse set does not contain value at index");
             }
-            return data[sparse[index]];
+            return data[slot(index)];
         }
 
         /**
@@ -139,7 +165,7 @@ namespace rome::core {
             if (!contains(index)) {
                 THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Sparse set does not contain value at index");
             }
-            return data[sparse[index]];
+            return data[slot(index)];
         }
 
         /**
@@ -151,7 +177,7 @@ namespace rome::core {
             if (!contains(index)) {
                 THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Sparse set does not contain value at index");
             }
-            return data[sparse[index]];
+            return data[slot(index)];
         }
 
         /**
@@ -163,7 +189,7 @@ namespace rome::core {
             if (!contains(index)) {
                 THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Sparse set does not contain value at index");
             }
-            return data[sparse[index]];
+            return data[slot(index)];
         }
 
         /**
@@ -171,7 +197,25 @@ namespace rome::core {
          * @param index The index to check.
          * @return True if the sparse set contains a value at the given index, false otherwise.
          */
-        inline b8 contains(u64 index) const noexcept { return index < sparse.size() && sparse[index] < size && dense[sparse[index]] == index; }
+        inline b8 contains(u64 index) const noexcept {
+            const u64 page = index / PageSize;
+            if (page >= pages.size() || !pages[page].slots) {
+                return false;
+            }
+            const Index position = pages[page].slots[index & (PageSize - 1)];
+            return position < size && dense[position] == index;
+        }
+
+        /**
+         * @brief Gets the dense position of the value at the given index.
+         * @param index The index to look up.
+         * @return The position of the value in the data returned by getData().
+         * @warning The sparse set must contain a value at the given index.
+         */
+        inline u64 getPosition(u64 index) const noexcept {
+            RM_ASSERT_MSG(contains(index), "Sparse set does not contain value at index");
+            return slot(index);
+        }
 
         /**
          * @brief Returns the number of elements in the sparse set.
@@ -179,18 +223,101 @@ namespace rome::core {
          */
         inline u64 getSize() const noexcept { return size; }
 
+        /**
+         * @brief Returns the number of sparse pages currently allocated.
+         * @return The number of allocated pages.
+         */
+        u64 getPageCount() const noexcept {
+            u64 count = 0;
+            for (const Page& page : pages) {
+                count += page.slots != nullptr;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Estimates the heap memory owned by the sparse set.
+         * @return The number of bytes reserved by the sparse pages, the page table and the dense arrays.
+         */
+        u64 getMemoryUsage() const noexcept {
+            return getPageCount() * PageSize * sizeof(Index) + pages.capacity() * sizeof(Page) + dense.capacity() * sizeof(u64) +
+                   data.capacity() * sizeof(T);
+        }
+
+        /**
+         * @brief Gets the resource the dense arrays allocate from.
+         * @return The memory resource.
+         */
+        inline std::pmr::memory_resource* getResource() const noexcept { return data.get_allocator().resource(); }
+
         /* Non-const iterator interfaces */
-        inline std::vector<T>::iterator begin() { return data.begin(); }
-        inline std::vector<T>::iterator end() { return data.begin() + size; }
+        inline std::pmr::vector<T>::iterator begin() { return data.begin(); }
+        inline std::pmr::vector<T>::iterator end() { return data.begin() + size; }
 
         /* Const iterator interfaces */
-        inline std::vector<T>::const_iterator begin() const { return data.begin(); }
-        inline std::vector<T>::const_iterator end() const { return data.begin() + size; }
+        inline std::pmr::vector<T>::const_iterator begin() const { return data.begin(); }
+        inline std::pmr::vector<T>::const_iterator end() const { return data.begin() + size; }
 
         private:
-        std::vector<u64> dense;   ///< Maps dense index to sparse index
-        std::vector<u64> sparse;  ///< Maps sparse index to dense index
-        std::vector<T> data;      ///< Data storage
-        u64 size;                 ///< Number of elements in the sparse set
+        /**
+         * @brief A lazily allocated block of PageSize sparse slots.
+         */
+        struct Page {
+            Unique<Index[]> slots;  ///< Maps sparse index to dense index, null until the page is first used.
+            u64 live = 0;           ///< Number of elements currently mapped through this page.
+        };
+
+        std::pmr::vector<u64> dense;  ///< Maps dense index to sparse index
+        std::vector<Page> pages;      ///< Maps sparse index to dense index, one page at a time
+        std::pmr::vector<T> data;     ///< Data storage
+        u64 size;                     ///< Number of elements in the sparse set
+
+        /**
+         * @brief Gets the sparse slot for an index whose page is known to be allocated.
+         * @param index The sparse index.
+         * @return A reference to the dense position stored for the index.
+         */
+        inline Index& slot(u64 index) noexcept { return pages[index / PageSize].slots[index & (PageSize - 1)]; }
+        /**
+         * @brief Gets the sparse slot for an index whose page is known to be allocated.
+         * @param index The sparse index.
+         * @return A const reference to the dense position stored for the index.
+         */
+        inline const Index& slot(u64 index) const noexcept { return pages[index / PageSize].slots[index & (PageSize - 1)]; }
+
+        /**
+         * @brief Maps a new index to the end of the dense array, allocating its page if needed.
+         * @param index The sparse index to map.
+         */
+        void bind(u64 index) {
+            RM_ASSERT_MSG(size < static_cast<u64>(std::numeric_limits<Index>::max()), "Sparse set is full for its Index type");
+
+            const u64 page = index / PageSize;
+            if (page >= pages.size()) {
+                pages.resize(page + 1);
+            }
+            if (!pages[page].slots) {
+                pages[page].slots = std::make_unique<Index[]>(PageSize);
+            }
+            pages[page].live++;
+
+            dense.push_back(index);
+            slot(index) = static_cast<Index>(size);
+        }
+
+        /**
+         * @brief Deep-copies the sparse pages of another set.
+         * @param other The set to copy the pages from.
+         */
+        void copyPages(const SparseSet& other) {
+            pages.clear();
+            pages.resize(other.pages.size());
+            for (u64 i = 0; i < other.pages.size(); i++) {
+                if (!other.pages[i].slots) continue;
+                pages[i].slots = std::make_unique<Index[]>(PageSize);
+                std::copy_n(other.pages[i].slots.get(), PageSize, pages[i].slots.get());
+                pages[i].live = other.pages[i].live;
+            }
+        }
     };
 }  // namespace rome::core
\ No newline at end of file
@@ -1,36 +1,521 @@
 #include "debug/log.hpp"
 
-#include <cstdarg>
-#include <iostream>
+#include <bit>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <cwchar>
+#include <thread>
+
+#include "concurrency/thread.hpp"
 
 namespace rome::core {
-    namespace ANSIColors {
-        constexpr const char* Black = "\x1b[38;5;0m";
-        constexpr const char* Gray = "\x1b[38;5;7m";
-        constexpr const char* Red = "\x1b[38;5;196m";
-        constexpr const char* Orange = "\x1b[38;5;208m";
-        constexpr const char* Green = "\x1b[38;5;46m";
-        constexpr const char* Yellow = "\x1b[38;5;226m";
-        constexpr const char* Blue = "\x1b[38;5;33m";
-        constexpr const char* Magenta = "\x1b[38;5;201m";
-        constexpr const char* Cyan = "\x1b[38;5;123m";
-        constexpr const char* White = "\x1b[38;5;15m";
-        constexpr const char* Default = "\x1b[39m";
-    }  // namespace ANSIColors
+    namespace {
+        /**
+         * @brief The coloured prefix of each log level: white, gray, blue, orange, red and magenta.
+         */
+        constexpr const char* Prefixes[6] = {"\x1b[38;5;15m[TRACE]: \x1b[39m",  "\x1b[38;5;7m[DEBUG]: \x1b[39m",
+                                             "\x1b[38;5;33m[INFO]:  \x1b[39m",  "\x1b[38;5;208m[WARN]:  \x1b[39m",
+                                             "\x1b[38;5;196m[ERROR]: \x1b[39m", "\x1b[38;5;201m[FATAL]: \x1b[39m"};
 
-    void logMessage(LogLevel level, const char* message, ...) {
-        std::string level_strings[6] = {
-            std::string(ANSIColors::White) + "[TRACE]: " + ANSIColors::Default, std::string(ANSIColors::Gray) + "[DEBUG]: " + ANSIColors::Default,
-            std::string(ANSIColors::Blue) + "[INFO]:  " + ANSIColors::Default,  std::string(ANSIColors::Orange) + "[WARN]:  " + ANSIColors::Default,
-            std::string(ANSIColors::Red) + "[ERROR]: " + ANSIColors::Default,   std::string(ANSIColors::Magenta) + "[FATAL]: " + ANSIColors::Default};
+        constexpr std::chrono::milliseconds IdleInterval{10};               ///< How long the background thread sleeps when idle.
+        constexpr std::chrono::milliseconds CrashTimeout{250};              ///< How long a crashing thread waits for the output.
+        constexpr int CrashSignals[] = {SIGSEGV, SIGABRT, SIGFPE, SIGILL};  ///< The signals that flush the logger.
+        void (*previousHandlers[std::size(CrashSignals)])(int) = {};        ///< The handlers replaced by the logger.
+
+        /**
+         * @brief The type of a captured argument, matching what va_arg must read for its conversion.
+         */
+        enum class Kind : u8 { Int, Long, LongLong, IntMax, Size, PtrDiff, Double, LongDouble, Pointer, String, NullString };
+
+        /**
+         * @brief A parsed printf conversion specification.
+         */
+        struct Spec {
+            const char* end = nullptr;  ///< One past the conversion character.
+            u8 stars = 0;               ///< The number of '*' width / precision arguments preceding the value.
+            b8 starPrecision = false;   ///< Whether the precision is a '*' argument.
+            i64 precision = -1;         ///< The literal precision, -1 if absent.
+            b8 consumes = false;        ///< Whether the conversion consumes an argument ('%%' does not).
+            b8 supported = false;       ///< Whether the conversion can be captured.
+            Kind kind = Kind::Int;      ///< The type of the value.
+        };
+
+        /**
+         * @brief Parses the conversion specification starting at a '%'.
+         * @param at The '%' character.
+         * @return The parsed specification.
+         */
+        Spec parse(const char* at) {
+            Spec spec;
+            const char* c = at + 1;
+            if (*c == '%') {
+                spec.end = c + 1;
+                spec.supported = true;
+                return spec;
+            }
+            while (*c && std::strchr("-+ #0'", *c)) c++;
+            if (*c == '*') {
+                spec.stars++;
+                c++;
+            } else {
+                while (*c >= '0' && *c <= '9') c++;
+            }
+            if (*c == '.') {
+                c++;
+                if (*c == '*') {
+                    spec.stars++;
+                    spec.starPrecision = true;
+                    c++;
+                } else {
+                    spec.precision = 0;
+                    while (*c >= '0' && *c <= '9') spec.precision = spec.precision * 10 + (*c++ - '0');
+                }
+            }
+
+            enum class Length : u8 { None, Short, Long, LongLong, IntMax, Size, PtrDiff, LongDouble } length = Length::None;
+            if (c[0] == 'h') {
+                length = Length::Short;
+                c += c[1] == 'h' ? 2 : 1;
+            } else if (c[0] == 'l' && c[1] == 'l') {
+                length = Length::LongLong;
+                c += 2;
+            } else if (*c == 'l' || *c == 'q' || *c == 'j' || *c == 'z' || *c == 't' || *c == 'L') {
+                constexpr const char* Modifiers = "lqjztL";
+                constexpr Length Lengths[] = {Length::Long, Length::LongLong, Length::IntMax, Length::Size, Length::PtrDiff, Length::LongDouble};
+                length = Lengths[std::strchr(Modifiers, *c) - Modifiers];
+                c++;
+            }
+            if (!*c) {
+                return spec;
+            }
+
+            spec.end = c + 1;
+            spec.consumes = true;
+            spec.supported = true;
+            switch (*c) {
+                case 'd':
+                case 'i':
+                case 'o':
+                case 'u':
+                case 'x':
+                case 'X':
+                    switch (length) {
+                        case Length::None:
+                        case Length::Short: spec.kind = Kind::Int; break;
+                        case Length::Long: spec.kind = Kind::Long; break;
+                        case Length::LongLong: spec.kind = Kind::LongLong; break;
+                        case Length::IntMax: spec.kind = Kind::IntMax; break;
+                        case Length::Size: spec.kind = Kind::Size; break;
+                        case Length::PtrDiff: spec.kind = Kind::PtrDiff; break;
+                        case Length::LongDouble: spec.supported = false; break;
+                    }
+                    break;
+                case 'c':
+                    spec.kind = Kind::Int;
+                    spec.supported = length == Length::None;
+                    break;
+                case 's':
+                    spec.kind = Kind::String;
+                    spec.supported = length == Length::None;
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A': spec.kind = length == Length::LongDouble ? Kind::LongDouble : Kind::Double; break;
+                case 'p': spec.kind = Kind::Pointer; break;
+                default: spec.supported = false; break;
+            }
+            return spec;
+        }
+
+        /**
+         * @brief Serializes arguments into a record's payload.
+         */
+        class Writer {
+            public:
+            Writer(std::byte* payload, u64 capacity) : payload(payload), capacity(capacity) {}
+
+            template <typename T>
+            b8 put(const T& value) {
+                if (size + sizeof(T) > capacity) return false;
+                std::memcpy(payload + size, &value, sizeof(T));
+                size += sizeof(T);
+                return true;
+            }
+
+            b8 put(const char* string, u16 length) {
+                if (!put(length) || size + length > capacity) return false;
+                std::memcpy(payload + size, string, length);
+                size += length;
+                return true;
+            }
+
+            u64 getSize() const { return size; }
+
+            private:
+            std::byte* payload;
+            u64 capacity;
+            u64 size = 0;
+        };
+
+        /**
+         * @brief Deserializes arguments from a record's payload.
+         */
+        class Reader {
+            public:
+            explicit Reader(const std::byte* payload) : payload(payload) {}
+
+            template <typename T>
+            T get() {
+                T value;
+                std::memcpy(&value, payload + offset, sizeof(T));
+                offset += sizeof(T);
+                return value;
+            }
+
+            std::string getString() {
+                const u16 length = get<u16>();
+                std::string string(reinterpret_cast<const char*>(payload + offset), length);
+                offset += length;
+                return string;
+            }
 
-        const std::string& level_string = level_strings[static_cast<u8>(level)];
-        std::cout << level_string;
+            private:
+            const std::byte* payload;
+            u64 offset = 0;
+        };
 
+        /**
+         * @brief Captures the arguments of a format into a payload.
+         * @return The number of payload bytes used, or -1 if the format cannot be captured.
+         */
+        i64 capture(const char* format, va_list args, std::byte* payload, u64 capacity) {
+            Writer writer(payload, capacity);
+            for (const char* c = std::strchr(format, '%'); c; c = std::strchr(c, '%')) {
+                const Spec spec = parse(c);
+                if (!spec.supported) return -1;
+                c = spec.end;
+                if (!spec.consumes) continue;
+
+                i64 precision = spec.precision;
+                for (u8 i = 0; i < spec.stars; i++) {
+                    const int star = va_arg(args, int);
+                    if (!writer.put(star)) return -1;
+                    if (spec.starPrecision && i + 1 == spec.stars) precision = star;
+                }
+                b8 fits = false;
+                switch (spec.kind) {
+                    case Kind::Int: fits = writer.put(spec.kind) && writer.put(va_arg(args, int)); break;
+                    case Kind::Long: fits = writer.put(spec.kind) && writer.put(va_arg(args, long)); break;
+                    case Kind::LongLong: fits = writer.put(spec.kind) && writer.put(va_arg(args, long long)); break;
+                    case Kind::IntMax: fits = writer.put(spec.kind) && writer.put(va_arg(args, intmax_t)); break;
+                    case Kind::Size: fits = writer.put(spec.kind) && writer.put(va_arg(args, size_t)); break;
+                    case Kind::PtrDiff: fits = writer.put(spec.kind) && writer.put(va_arg(args, ptrdiff_t)); break;
+                    case Kind::Double: fits = writer.put(spec.kind) && writer.put(va_arg(args, double)); break;
+                    case Kind::LongDouble: fits = writer.put(spec.kind) && writer.put(va_arg(args, long double)); break;
+                    case Kind::Pointer: fits = writer.put(spec.kind) && writer.put(va_arg(args, void*)); break;
+                    case Kind::String:
+                    case Kind::NullString: {
+                        const char* string = va_arg(args, const char*);
+                        if (!string) {
+                            fits = writer.put(Kind::NullString);
+                            break;
+                        }
+                        const u64 length = precision >= 0 ? strnlen(string, static_cast<u64>(precision)) : std::strlen(string);
+                        fits = length <= UINT16_MAX && writer.put(Kind::String) && writer.put(string, static_cast<u16>(length));
+                        break;
+                    }
+                }
+                if (!fits) return -1;
+            }
+            return static_cast<i64>(writer.getSize());
+        }
+
+        /**
+         * @brief Appends a formatted piece of a message.
+         */
+        template <typename... Args>
+        void append(std::string& out, const char* format, Args... args) {
+            char stack[256];
+            const int size = std::snprintf(stack, sizeof(stack), format, args...);
+            if (size < 0) return;
+            if (static_cast<u64>(size) < sizeof(stack)) {
+                out.append(stack, size);
+                return;
+            }
+            const u64 at = out.size();
+            out.resize(at + size + 1);
+            std::snprintf(out.data() + at, size + 1, format, args...);
+            out.resize(at + size);
+        }
+
+        /**
+         * @brief Formats a captured message, one conversion at a time, exactly as printf would have.
+         */
+        void format(std::string& out, const char* format, const std::byte* payload) {
+            Reader reader(payload);
+            std::string piece;
+            const char* start = format;
+            for (const char* c = std::strchr(format, '%'); c; c = std::strchr(c, '%')) {
+                const Spec spec = parse(c);
+                c = spec.end;
+                if (!spec.consumes) continue;
+
+                // Format everything since the last conversion, up to and including this one
+                piece.assign(start, spec.end);
+                start = spec.end;
+                int stars[2] = {};
+                for (u8 i = 0; i < spec.stars; i++) stars[i] = reader.get<int>();
+                auto emit = [&](auto value) {
+                    switch (spec.stars) {
+                        case 0: append(out, piece.c_str(), value); break;
+                        case 1: append(out, piece.c_str(), stars[0], value); break;
+                        default: append(out, piece.c_str(), stars[0], stars[1], value); break;
+                    }
+                };
+                switch (reader.get<Kind>()) {
+                    case Kind::Int: emit(reader.get<int>()); break;
+                    case Kind::Long: emit(reader.get<long>()); break;
+                    case Kind::LongLong: emit(reader.get<long long>()); break;
+                    case Kind::IntMax: emit(reader.get<intmax_t>()); break;
+                    case Kind::Size: emit(reader.get<size_t>()); break;
+                    case Kind::PtrDiff: emit(reader.get<ptrdiff_t>()); break;
+                    case Kind::Double: emit(reader.get<double>()); break;
+                    case Kind::LongDouble: emit(reader.get<long double>()); break;
+                    case Kind::Pointer: emit(reader.get<void*>()); break;
+                    case Kind::String: emit(reader.getString().c_str()); break;
+                    case Kind::NullString: emit(static_cast<const char*>(nullptr)); break;
+                }
+            }
+            append(out, start);
+        }
+    }  // namespace
+
+    thread_local Logger::Handle Logger::local;
+
+    void logMessage(LogLevel level, const char* message, ...) {
         va_list args;
         va_start(args, message);
-        vprintf(message, args);
+        Logger::getInstance().log(level, message, args);
         va_end(args);
-        std::cout << std::endl;
     }
-}  // namespace rome::core
+
+    Logger::Handle::~Handle() {
+        if (ring) {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    }
+
+    Logger::Logger() = default;
+
+    Logger::~Logger() { stop(); }
+
+    void Logger::start(Policy policy, u64 capacity) {
+        if (running.exchange(true)) {
+            return;
+        }
+        this->policy.store(policy);
+        this->capacity.store(std::bit_ceil(std::max<u64>(capacity, 2)));
+        for (u64 i = 0; i < std::size(CrashSignals); i++) {
+            previousHandlers[i] = std::signal(CrashSignals[i], &Logger::onCrash);
+        }
+        backend = MakeUnique<Thread>("Logger");
+        backend->run([this]() { run(); });
+        async.store(true, std::memory_order_release);
+    }
+
+    void Logger::stop() {
+        if (!running.load()) {
+            return;
+        }
+        async.store(false, std::memory_order_release);
+        running.store(false);
+        notify();
+        backend->join();
+        backend.reset();
+        drain();
+        for (u64 i = 0; i < std::size(CrashSignals); i++) {
+            std::signal(CrashSignals[i], previousHandlers[i] == SIG_ERR ? SIG_DFL : previousHandlers[i]);
+        }
+    }
+
+    void Logger::flush() {
+        if (isAsync()) {
+            const u64 target = sequence.load();
+            notify();
+            std::unique_lock lock(wakeLock);
+            drained.wait(lock, [&]() { return written.load() >= target || !running.load(); });
+            return;
+        }
+        std::lock_guard guard(outputLock);
+        std::fflush(output);
+    }
+
+    void Logger::log(LogLevel level, const char* format, va_list args) {
+        if (!isAsync()) {
+            write(level, format, args);
+            return;
+        }
+
+        Ring& ring = acquire();
+        const u64 head = ring.head.load(std::memory_order_relaxed);
+        while (head - ring.tail.load(std::memory_order_acquire) >= ring.capacity) {
+            if (policy.load(std::memory_order_relaxed) == Policy::Drop && level != LogLevel::Fatal) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            notify();
+            std::this_thread::yield();
+        }
+
+        Record& record = ring.records[head & (ring.capacity - 1)];
+        va_list copy;
+        va_copy(copy, args);
+        const i64 size = capture(format, copy, record.payload, PayloadSize);
+        va_end(copy);
+        // The format often lives no longer than the call, e.g. a std::string, so it travels after the arguments
+        const u64 length = size < 0 ? 0 : std::strlen(format) + 1;
+        if (size < 0 || static_cast<u64>(size) + length > PayloadSize) {
+            // Too many arguments, strings too long or an exotic conversion: write it out in order, on this thread
+            flush();
+            write(level, format, args);
+            return;
+        }
+        std::memcpy(record.payload + size, format, length);
+        record.format = reinterpret_cast<const char*>(record.payload + size);
+        record.level = level;
+        record.size = static_cast<u16>(size + length);
+        record.sequence = sequence.fetch_add(1);
+        ring.head.store(head + 1, std::memory_order_seq_cst);
+        if (sleeping.load(std::memory_order_seq_cst)) {
+            notify();
+        }
+        if (level == LogLevel::Fatal) {
+            flush();
+        }
+    }
+
+    void Logger::setOutput(std::FILE* output) {
+        flush();
+        std::lock_guard guard(outputLock);
+        this->output = output;
+    }
+
+    void Logger::write(LogLevel level, const char* format, va_list args) {
+        std::lock_guard guard(outputLock);
+        std::fputs(Prefixes[static_cast<u8>(level)], output);
+        std::vfprintf(output, format, args);
+        std::fputc('\n', output);
+        std::fflush(output);
+    }
+
+    Logger::Ring& Logger::acquire() {
+        if (!local.ring) {
+            Unique<Ring> ring = MakeUnique<Ring>();
+            ring->capacity = capacity.load();
+            ring->records = MakeUnique<Record[]>(ring->capacity);
+
+            std::lock_guard guard(ringsLock);
+            rings.push_back(std::move(ring));
+            local.ring = rings.back().get();
+        }
+        return *local.ring;
+    }
+
+    u64 Logger::drain() {
+        u64 count = 0;
+        {
+            std::lock_guard guard(ringsLock);
+            std::vector<std::pair<Ring*, u64>> heads;
+            std::vector<const Record*> records;
+            for (const Unique<Ring>& ring : rings) {
+                const u64 head = ring->head.load(std::memory_order_acquire);
+                for (u64 i = ring->tail.load(std::memory_order_relaxed); i < head; i++) {
+                    records.push_back(&ring->records[i & (ring->capacity - 1)]);
+                }
+                heads.emplace_back(ring.get(), head);
+            }
+            if (records.empty()) {
+                return 0;
+            }
+
+            std::sort(records.begin(), records.end(), [](const Record* a, const Record* b) { return a->sequence < b->sequence; });
+            std::string batch;
+            for (const Record* record : records) {
+                batch += Prefixes[static_cast<u8>(record->level)];
+                format(batch, record->format, record->payload);
+                batch += '\n';
+            }
+            {
+                std::lock_guard outputGuard(outputLock);
+                std::fwrite(batch.data(), 1, batch.size(), output);
+                std::fflush(output);
+            }
+
+            for (auto [ring, head] : heads) {
+                ring->tail.store(head, std::memory_order_release);
+            }
+            std::erase_if(rings, [](const Unique<Ring>& ring) {
+                return ring->retired.load(std::memory_order_acquire) &&
+                       ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+            });
+            count = records.size();
+        }
+
+        written.fetch_add(count);
+        std::lock_guard guard(wakeLock);
+        drained.notify_all();
+        return count;
+    }
+
+    b8 Logger::isPending() {
+        std::lock_guard guard(ringsLock);
+        return std::any_of(rings.begin(), rings.end(), [](const Unique<Ring>& ring) {
+            return ring->head.load(std::memory_order_seq_cst) != ring->tail.load(std::memory_order_relaxed);
+        });
+    }
+
+    void Logger::notify() {
+        std::lock_guard guard(wakeLock);
+        wake.notify_one();
+    }
+
+    void Logger::run() {
+        while (running.load()) {
+            if (drain() > 0) {
+                continue;
+            }
+            std::unique_lock lock(wakeLock);
+            sleeping.store(true, std::memory_order_seq_cst);
+            if (running.load() && !isPending()) {
+                wake.wait_for(lock, IdleInterval);
+            }
+            sleeping.store(false, std::memory_order_relaxed);
+        }
+        drain();
+        std::lock_guard guard(wakeLock);
+        drained.notify_all();
+    }
+
+    void Logger::onCrash(int signal) {
+        // Best effort: the background thread is likely still alive, so give it a moment to write everything out
+        Logger& logger = getInstance();
+        const u64 target = logger.sequence.load();
+        const auto deadline = std::chrono::steady_clock::now() + CrashTimeout;
+        while (logger.written.load() < target && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        for (u64 i = 0; i < std::size(CrashSignals); i++) {
+            if (CrashSignals[i] == signal) {
+                std::signal(signal, previousHandlers[i] == SIG_ERR || !previousHandlers[i] ? SIG_DFL : previousHandlers[i]);
+            }
+        }
+        std::raise(signal);
+    }
+}  // namespace rome::core
\ No newline at end of file
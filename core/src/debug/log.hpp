@@ -1,8 +1,14 @@
 #pragma once
 
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+
 #include "prelude.hpp"
 
 namespace rome::core {
+    class Thread;
+
     /**
      * @brief Log types in ascending order of importance.
      */
@@ -15,6 +21,183 @@ namespace rome::core {
      * @param ... The arguments to format the message with.
      */
     void RM_API logMessage(LogLevel level, const char*, ...);
+
+    /**
+     * @brief The backend behind logMessage. Writes synchronously by default, or asynchronously once started.
+     * In asynchronous mode, logging threads copy the format and the raw arguments into their own single-producer
+     * ring without locking, and a background thread formats and writes them in batches, ordered by the time they were
+     * logged. Fatal messages, flush() and crash signals wait for everything logged so far to be written.
+     * @note Formats and %s arguments are copied, so they only need to live through the call. Messages whose format
+     *       and arguments do not fit a record are written synchronously instead.
+     */
+    class RM_API Logger final {
+        public:
+        /**
+         * @brief What a logging thread does when its ring is full.
+         */
+        enum class Policy : u8 {
+            Drop,  ///< Discard the message and count it. Fatal messages are never dropped.
+            Block  ///< Wait for the background thread to make room.
+        };
+
+        static constexpr u64 DefaultCapacity = 256;  ///< The default number of messages queued per thread.
+
+        Logger();
+        ~Logger();
+        Logger(const Logger&) = delete;
+        Logger& operator=(const Logger&) = delete;
+        Logger(Logger&&) = delete;
+        Logger& operator=(Logger&&) = delete;
+
+        /**
+         * @brief Gets the singleton instance of the logger.
+         * @return The logger instance.
+         */
+        static Logger& getInstance() {
+            static Logger instance;
+            return instance;
+        }
+
+        /**
+         * @brief Switches to asynchronous mode, spawning the background thread and installing the crash handlers.
+         * @param policy What to do when a thread's ring is full (default is Block).
+         * @param capacity The number of messages queued per thread, rounded up to a power of two. Only applies to
+         *        threads that have not logged asynchronously yet.
+         */
+        void start(Policy policy = Policy::Block, u64 capacity = DefaultCapacity);
+
+        /**
+         * @brief Writes out every queued message and switches back to synchronous mode.
+         * @warning Messages logged concurrently with this call may be written after it returns.
+         */
+        void stop();
+
+        /**
+         * @brief Blocks until every message logged so far has been written and the output flushed.
+         * @note This function is thread-safe.
+         */
+        void flush();
+
+        /**
+         * @brief Logs a message. Called by logMessage.
+         * @param level The log level of the message.
+         * @param format The printf-style format of the message.
+         * @param args The arguments to format the message with.
+         * @note This function is thread-safe, and lock-free in asynchronous mode once the thread has logged once.
+         */
+        void log(LogLevel level, const char* format, va_list args);
+
+        /**
+         * @brief Redirects the output, stdout by default.
+         * @param output The stream to write to. Must stay open while the logger uses it.
+         */
+        void setOutput(std::FILE* output);
+
+        /**
+         * @brief Checks whether the logger is in asynchronous mode.
+         * @return True if messages are written by the background thread, false otherwise.
+         */
+        inline b8 isAsync() const noexcept { return async.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Gets the number of messages dropped because a ring was full.
+         * @return The number of dropped messages.
+         */
+        inline u64 getDropped() const noexcept { return dropped.load(std::memory_order_relaxed); }
+
+        private:
+        static constexpr u64 PayloadSize = 232;  ///< The bytes of captured arguments a message can hold.
+
+        /**
+         * @brief A message waiting to be formatted: its format and its arguments, serialized by kind.
+         */
+        struct Record {
+            u64 sequence;                    ///< The global order of the message.
+            const char* format;              ///< The format of the message, copied after the arguments in the payload.
+            LogLevel level;                  ///< The log level of the message.
+            u16 size;                        ///< The number of payload bytes used, format included.
+            std::byte payload[PayloadSize];  ///< The captured arguments, then the format.
+        };
+
+        /**
+         * @brief A single-producer, single-consumer ring of records owned by one logging thread.
+         */
+        struct Ring {
+            u64 capacity;                          ///< The number of records, a power of two.
+            Unique<Record[]> records;              ///< The records.
+            alignas(64) std::atomic<u64> head{0};  ///< The number of records published by the owner.
+            alignas(64) std::atomic<u64> tail{0};  ///< The number of records written by the background thread.
+            std::atomic<b8> retired{false};        ///< Whether the owning thread has exited.
+        };
+
+        /**
+         * @brief The current thread's ring, retired when the thread exits.
+         */
+        struct Handle {
+            Ring* ring = nullptr;  ///< The ring, null until the thread logs asynchronously.
+            ~Handle();
+        };
+
+        static thread_local Handle local;            ///< The current thread's ring.
+        std::atomic<b8> async{false};                ///< Whether messages go through the rings.
+        std::atomic<b8> running{false};              ///< Whether the background thread should keep running.
+        std::atomic<b8> sleeping{false};             ///< Whether the background thread is waiting for messages.
+        std::atomic<Policy> policy{Policy::Block};   ///< What to do when a ring is full.
+        std::atomic<u64> capacity{DefaultCapacity};  ///< The capacity of newly created rings.
+        std::atomic<u64> sequence{0};                ///< The number of messages published so far.
+        std::atomic<u64> written{0};                 ///< The number of messages written so far.
+        std::atomic<u64> dropped{0};                 ///< The number of messages dropped so far.
+        std::FILE* output = stdout;                  ///< The stream to write to.
+        std::mutex outputLock;                       ///< Serializes writes to the output.
+        std::mutex ringsLock;                        ///< Guards the list of rings.
+        std::vector<Unique<Ring>> rings;             ///< Every live ring.
+        std::mutex wakeLock;                         ///< Guards the condition variables.
+        std::condition_variable wake;                ///< Wakes the background thread.
+        std::condition_variable drained;             ///< Wakes threads waiting in flush().
+        Unique<Thread> backend;                      ///< The background thread.
+
+        /**
+         * @brief Formats and writes a message on the calling thread.
+         * @param level The log level of the message.
+         * @param format The format of the message.
+         * @param args The arguments to format the message with.
+         */
+        void write(LogLevel level, const char* format, va_list args);
+
+        /**
+         * @brief Gets the current thread's ring, creating it on first use.
+         * @return The current thread's ring.
+         */
+        Ring& acquire();
+
+        /**
+         * @brief Formats and writes every published record, in sequence order.
+         * @return The number of records written.
+         */
+        u64 drain();
+
+        /**
+         * @brief Checks whether any ring holds a published record.
+         * @return True if there is something to drain, false otherwise.
+         */
+        b8 isPending();
+
+        /**
+         * @brief Wakes the background thread if it is waiting.
+         */
+        void notify();
+
+        /**
+         * @brief The background thread's loop.
+         */
+        void run();
+
+        /**
+         * @brief Gives the background thread a bounded amount of time to write everything out, then re-raises the signal.
+         * @param signal The signal that was raised.
+         */
+        static void onCrash(int signal);
+    };
 }  // namespace rome::core
 
 /* Mute debug logs in release build */
@@ -5,87 +5,67 @@
 #include "concurrency/thread.hpp"
 #include "debug/exception.hpp"
 
-static std::atomic_bool metricsRunning = false;       ///< Whether the metrics system should be logging performance data.
-static thread_local rome::b8 recursionGuard = false;  ///< Used to prevent circular new / delete calls.
-
-void* operator new(size_t size) {
-    if (!metricsRunning) {
-        return std::malloc(size);
-    }
-    if (!rome::core::Metrics::getInstance().isRegistered() || !rome::core::Metrics::getInstance().isMemoryTracking()) {
-        return std::malloc(size);
-    }
-    if (!recursionGuard) {
-        recursionGuard = true;
-        void* ptr = std::malloc(size);
-        if (!ptr) {
-            recursionGuard = false;
-            throw std::bad_alloc();
-        }
-
-        rome::core::Metrics::getInstance().registerAllocation(ptr, static_cast<rome::u64>(size));
-        recursionGuard = false;
-        return ptr;
-    }
-    return std::malloc(size);
+#if defined(RM_LINUX)
+#include <malloc.h>
+#elif defined(RM_MACOS)
+#include <malloc/malloc.h>
+#elif defined(RM_WINDOWS)
+#include <malloc.h>
+#endif
+
+static std::atomic_bool metricsRunning = false;  ///< Whether the metrics system should be logging performance data.
+
+/**
+ * @brief Asks the allocator for the usable size of a block, so frees can be accounted without remembering every pointer.
+ * @param ptr The block, allocated with std::malloc.
+ * @return The usable size of the block in bytes.
+ */
+static inline rome::u64 usableSize(void* ptr) noexcept {
+#if defined(RM_LINUX)
+    return malloc_usable_size(ptr);
+#elif defined(RM_MACOS)
+    return malloc_size(ptr);
+#elif defined(RM_WINDOWS)
+    return _msize(ptr);
+#else
+    return 0;
+#endif
 }
 
-void operator delete(void* ptr) noexcept {
-    if (!metricsRunning) {
-        std::free(ptr);
-        return;
+/**
+ * @brief Allocates a block, accounting for it if the metrics are running.
+ * @param size The number of bytes requested.
+ * @return The allocated block.
+ */
+static inline void* trackedAllocate(size_t size) {
+    void* ptr = std::malloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
     }
-    if (!rome::core::Metrics::getInstance().isRegistered() || !rome::core::Metrics::getInstance().isMemoryTracking()) {
-        std::free(ptr);
-        return;
+    if (metricsRunning.load(std::memory_order_relaxed)) {
+        rome::core::Metrics::getInstance().registerAllocation(ptr, usableSize(ptr));
     }
-    if (!recursionGuard) {
-        recursionGuard = true;
-        rome::core::Metrics::getInstance().registerDeallocation(ptr);
-        recursionGuard = false;
+    return ptr;
+}
+
+/**
+ * @brief Frees a block, accounting for it if the metrics are running.
+ * @param ptr The block to free.
+ */
+static inline void trackedFree(void* ptr) noexcept {
+    if (ptr && metricsRunning.load(std::memory_order_relaxed)) {
+        rome::core::Metrics::getInstance().registerDeallocation(ptr, usableSize(ptr));
     }
     std::free(ptr);
 }
 
-void* operator new[](size_t size) {
-    if (!metricsRunning) {
-        return std::malloc(size);
-    }
-    if (!rome::core::Metrics::getInstance().isRegistered() || !rome::core::Metrics::getInstance().isMemoryTracking()) {
-        return std::malloc(size);
-    }
-    if (!recursionGuard) {
-        recursionGuard = true;
-        void* ptr = std::malloc(size);
-        if (!ptr) {
-            recursionGuard = false;
-            throw std::bad_alloc();
-        }
+void* operator new(size_t size) { return trackedAllocate(size); }
 
-        rome::core::Metrics::getInstance().registerAllocation(ptr, static_cast<rome::u64>(size));
-        recursionGuard = false;
-        return ptr;
-    }
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
 
-    return std::malloc(size);
-}
+void* operator new[](size_t size) { return trackedAllocate(size); }
 
-void operator delete[](void* ptr) noexcept {
-    if (!metricsRunning) {
-        std::free(ptr);
-        return;
-    }
-    if (!rome::core::Metrics::getInstance().isRegistered() || !rome::core::Metrics::getInstance().isMemoryTracking()) {
-        std::free(ptr);
-        return;
-    }
-    if (!recursionGuard) {
-        recursionGuard = true;
-        rome::core::Metrics::getInstance().registerDeallocation(ptr);
-        recursionGuard = false;
-    }
-    std::free(ptr);
-}
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
 
 namespace rome::core {
     Metrics::~Metrics() {
@@ -103,43 +83,53 @@ namespace rome::core {
 
     void Metrics::stop() { metricsRunning = false; }
 
-    void Metrics::registerAllocation(void* ptr, u64 size) {
-        if (!ptr) return;
+    thread_local Metrics::ThreadMetrics* Metrics::local = nullptr;
 
-        std::lock_guard<std::mutex> lock(registrarMutex);
-        ThreadMetrics* metrics = threadMetrics[ThreadInfo::getLocalID()];
-        metrics->allocations[ptr] = size;
-        metrics->currentBytes += size;
-        metrics->totalBytes += size;
-        metrics->totalAllocations++;
-        if (metrics->currentBytes > metrics->peakBytes) {
-            metrics->peakBytes = metrics->currentBytes;
+    void Metrics::registerAllocation(void* ptr, u64 size) noexcept {
+        ThreadMetrics* metrics = local;
+        if (!ptr || !metrics || !metrics->memoryLogging.load(std::memory_order_relaxed)) return;
+
+        // Single writer: plain load / store pairs instead of read-modify-write instructions
+        const u64 allocated = metrics->allocatedBytes.load(std::memory_order_relaxed) + size;
+        metrics->allocatedBytes.store(allocated, std::memory_order_relaxed);
+        metrics->allocations.store(metrics->allocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        const u64 current = allocated - std::min(allocated, metrics->freedBytes.load(std::memory_order_relaxed));
+        if (current > metrics->peakBytes.load(std::memory_order_relaxed)) {
+            metrics->peakBytes.store(current, std::memory_order_relaxed);
         }
     }
 
-    void Metrics::registerDeallocation(void* ptr) {
-        if (!ptr) {
-            RM_WARN("Attempted to deallocate a null pointer");
-            return;
-        }
+    void Metrics::registerDeallocation(void* ptr, u64 size) noexcept {
+        ThreadMetrics* metrics = local;
+        if (!ptr || !metrics || !metrics->memoryLogging.load(std::memory_order_relaxed)) return;
+
+        metrics->freedBytes.store(metrics->freedBytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        metrics->deallocations.store(metrics->deallocations.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
 
+    void Metrics::registerArenaFrame(const UUID& thread, u64 bytes) noexcept {
+        // The phase is ended by another thread than the arena's, so find its counters under the lock
         std::lock_guard<std::mutex> lock(registrarMutex);
-        ThreadMetrics* metrics = threadMetrics[ThreadInfo::getLocalID()];
-        auto it = metrics->allocations.find(ptr);
-        if (it != metrics->allocations.end()) {
-            u64 size = it->second;
-            metrics->currentBytes -= size;
-            metrics->allocations.erase(it);
-            return;
+        auto it = threadMetrics.find(thread);
+        if (it != threadMetrics.end() && bytes > it->second->arenaPeakBytes.load(std::memory_order_relaxed)) {
+            it->second->arenaPeakBytes.store(bytes, std::memory_order_relaxed);
         }
     }
 
+    void Metrics::registerEventOverflow(u64 dropped, u64 spilled) noexcept {
+        ThreadMetrics* metrics = local;
+        if (!metrics) return;
+
+        metrics->droppedEvents.store(metrics->droppedEvents.load(std::memory_order_relaxed) + dropped, std::memory_order_relaxed);
+        metrics->spilledEvents.store(metrics->spilledEvents.load(std::memory_order_relaxed) + spilled, std::memory_order_relaxed);
+    }
+
     void Metrics::report() const {
         RM_INFO("Memory metrics:");
         for (const auto& [thread, metrics] : threadMetrics) {
-            RM_INFO(getMemoryMetrics(thread).c_str());
+            RM_INFO("%s", getMemoryMetrics(thread).c_str());
         }
-        RM_INFO(getGlobalMemoryMetrics().c_str());
+        RM_INFO("%s", getGlobalMemoryMetrics().c_str());
     }
 
     std::string Metrics::getMemoryMetrics(const UUID& thread) const {
@@ -150,7 +140,9 @@ namespace rome::core {
                std::to_string(getTotalBytes(thread)) + " B\n          - Peak                " + std::to_string(getPeakBytes(thread)) +
                " B\n          - Current / leaked    " + std::to_string(getCurrentBytes(thread)) + " B\n          - Total allocations   " +
                std::to_string(getTotalAllocations(thread)) + "\n          - Total deallocations " +
-               std::to_string(getTotalAllocations(thread) - getMissingDeallocations(thread));
+               std::to_string(getTotalAllocations(thread) - getMissingDeallocations(thread)) + "\n          - Arena peak / frame  " +
+               std::to_string(getArenaPeakBytes(thread)) + " B\n          - Dropped events      " + std::to_string(getDroppedEvents(thread)) +
+               "\n          - Spilled events      " + std::to_string(getSpilledEvents(thread));
     }
 
     std::string Metrics::getMemoryMetrics() const { return getMemoryMetrics(ThreadInfo::getLocalID()); }
@@ -159,7 +151,9 @@ namespace rome::core {
         return "Global heap metrics:\n          - Total               " + std::to_string(getGlobalTotalBytes()) +
                " B\n          - Peak                " + std::to_string(getGlobalPeakBytes()) + " B\n          - Current / leaked    " +
                std::to_string(getGlobalCurrentBytes()) + " B\n          - Total allocations   " + std::to_string(getGlobalTotalAllocations()) +
-               "\n          - Total deallocations " + std::to_string(getGlobalTotalAllocations() - getGlobalMissingDeallocations());
+               "\n          - Total deallocations " + std::to_string(getGlobalTotalAllocations() - getGlobalMissingDeallocations()) +
+               "\n          - Arena peak / frame  " + std::to_string(getGlobalArenaPeakBytes()) + " B\n          - Dropped events      " +
+               std::to_string(getGlobalDroppedEvents()) + "\n          - Spilled events      " + std::to_string(getGlobalSpilledEvents());
     }
 
     const std::string& Metrics::getThreadAlias(const UUID& thread) const {
@@ -175,32 +169,36 @@ namespace rome::core {
         if (!isRegistered(thread)) {
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
         }
-        return threadMetrics.at(thread)->currentBytes;
+        return threadMetrics.at(thread)->getCurrentBytes();
     }
 
     u64 Metrics::getCurrentBytes() const { return getCurrentBytes(ThreadInfo::getLocalID()); }
 
     u64 Metrics::getGlobalCurrentBytes() const {
-        u64 currentBytes = 0;
+        std::lock_guard<std::mutex> lock(registrarMutex);
+        u64 allocated = 0;
+        u64 freed = 0;
         for (const auto& [thread, metrics] : threadMetrics) {
-            currentBytes += threadMetrics.at(thread)->currentBytes;
+            allocated += metrics->allocatedBytes.load(std::memory_order_relaxed);
+            freed += metrics->freedBytes.load(std::memory_order_relaxed);
         }
-        return currentBytes;
+        return allocated > freed ? allocated - freed : 0;
     }
 
     u64 Metrics::getPeakBytes(const UUID& thread) const {
         if (!isRegistered(thread)) {
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
         }
-        return threadMetrics.at(thread)->peakBytes;
+        return threadMetrics.at(thread)->peakBytes.load(std::memory_order_relaxed);
     }
 
     u64 Metrics::getPeakBytes() const { return getPeakBytes(ThreadInfo::getLocalID()); }
 
     u64 Metrics::getGlobalPeakBytes() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
         u64 peakBytes = 0;
         for (const auto& [thread, metrics] : threadMetrics) {
-            peakBytes += threadMetrics.at(thread)->peakBytes;
+            peakBytes += metrics->peakBytes.load(std::memory_order_relaxed);
         }
         return peakBytes;
     }
@@ -209,15 +207,16 @@ namespace rome::core {
         if (!isRegistered(thread)) {
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
         }
-        return threadMetrics.at(thread)->totalBytes;
+        return threadMetrics.at(thread)->allocatedBytes.load(std::memory_order_relaxed);
     }
 
     u64 Metrics::getTotalBytes() const { return getTotalBytes(ThreadInfo::getLocalID()); }
 
     u64 Metrics::getGlobalTotalBytes() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
         u64 totalBytes = 0;
         for (const auto& [thread, metrics] : threadMetrics) {
-            totalBytes += threadMetrics.at(thread)->totalBytes;
+            totalBytes += metrics->allocatedBytes.load(std::memory_order_relaxed);
         }
         return totalBytes;
     }
@@ -226,15 +225,16 @@ namespace rome::core {
         if (!isRegistered(thread)) {
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
         }
-        return threadMetrics.at(thread)->totalAllocations;
+        return threadMetrics.at(thread)->allocations.load(std::memory_order_relaxed);
     }
 
     u64 Metrics::getTotalAllocations() const { return getTotalAllocations(ThreadInfo::getLocalID()); }
 
     u64 Metrics::getGlobalTotalAllocations() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
         u64 totalAllocations = 0;
         for (const auto& [thread, metrics] : threadMetrics) {
-            totalAllocations += threadMetrics.at(thread)->totalAllocations;
+            totalAllocations += metrics->allocations.load(std::memory_order_relaxed);
         }
         return totalAllocations;
     }
@@ -243,17 +243,77 @@ namespace rome::core {
         if (!isRegistered(thread)) {
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
         }
-        return threadMetrics.at(thread)->allocations.size();
+        const ThreadMetrics* metrics = threadMetrics.at(thread);
+        const u64 allocations = metrics->allocations.load(std::memory_order_relaxed);
+        const u64 deallocations = metrics->deallocations.load(std::memory_order_relaxed);
+        return allocations > deallocations ? allocations - deallocations : 0;
     }
 
     u64 Metrics::getMissingDeallocations() const { return getMissingDeallocations(ThreadInfo::getLocalID()); }
 
     u64 Metrics::getGlobalMissingDeallocations() const {
-        u64 missingDeallocations = 0;
+        std::lock_guard<std::mutex> lock(registrarMutex);
+        u64 allocations = 0;
+        u64 deallocations = 0;
+        for (const auto& [thread, metrics] : threadMetrics) {
+            allocations += metrics->allocations.load(std::memory_order_relaxed);
+            deallocations += metrics->deallocations.load(std::memory_order_relaxed);
+        }
+        return allocations > deallocations ? allocations - deallocations : 0;
+    }
+
+    u64 Metrics::getArenaPeakBytes(const UUID& thread) const {
+        if (!isRegistered(thread)) {
+            THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
+        }
+        return threadMetrics.at(thread)->arenaPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    u64 Metrics::getArenaPeakBytes() const { return getArenaPeakBytes(ThreadInfo::getLocalID()); }
+
+    u64 Metrics::getGlobalArenaPeakBytes() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
+        u64 arenaPeakBytes = 0;
+        for (const auto& [thread, metrics] : threadMetrics) {
+            arenaPeakBytes = std::max(arenaPeakBytes, metrics->arenaPeakBytes.load(std::memory_order_relaxed));
+        }
+        return arenaPeakBytes;
+    }
+
+    u64 Metrics::getDroppedEvents(const UUID& thread) const {
+        if (!isRegistered(thread)) {
+            THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
+        }
+        return threadMetrics.at(thread)->droppedEvents.load(std::memory_order_relaxed);
+    }
+
+    u64 Metrics::getDroppedEvents() const { return getDroppedEvents(ThreadInfo::getLocalID()); }
+
+    u64 Metrics::getGlobalDroppedEvents() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
+        u64 droppedEvents = 0;
+        for (const auto& [thread, metrics] : threadMetrics) {
+            droppedEvents += metrics->droppedEvents.load(std::memory_order_relaxed);
+        }
+        return droppedEvents;
+    }
+
+    u64 Metrics::getSpilledEvents(const UUID& thread) const {
+        if (!isRegistered(thread)) {
+            THROW_CORE_EXCEPTION(Exception::Type::NotFound, "Thread ID not registered");
+        }
+        return threadMetrics.at(thread)->spilledEvents.load(std::memory_order_relaxed);
+    }
+
+    u64 Metrics::getSpilledEvents() const { return getSpilledEvents(ThreadInfo::getLocalID()); }
+
+    u64 Metrics::getGlobalSpilledEvents() const {
+        std::lock_guard<std::mutex> lock(registrarMutex);
+        u64 spilledEvents = 0;
         for (const auto& [thread, metrics] : threadMetrics) {
-            missingDeallocations += threadMetrics.at(thread)->allocations.size();
+            spilledEvents += metrics->spilledEvents.load(std::memory_order_relaxed);
         }
-        return missingDeallocations;
+        return spilledEvents;
     }
 
     b8 Metrics::isMemoryTracking(const UUID& thread) const {
@@ -291,8 +351,9 @@ namespace rome::core {
             return;
         }
 
-        threadMetrics[ThreadInfo::getLocalID()] = new ThreadMetrics();
-        threadMetrics[ThreadInfo::getLocalID()]->alias = alias;
+        local = new ThreadMetrics();
+        local->alias = alias;
+        threadMetrics[ThreadInfo::getLocalID()] = local;
     }
 
     void Metrics::unregisterThread() {
@@ -302,6 +363,7 @@ namespace rome::core {
             return;
         }
 
+        local = nullptr;  // Stop accounting before the counters themselves are freed
         delete threadMetrics[ThreadInfo::getLocalID()];
         threadMetrics.erase(ThreadInfo::getLocalID());
     }
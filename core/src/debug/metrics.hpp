@@ -6,6 +6,10 @@
 namespace rome::core {
     /**
      * @brief Tracks program time and memory performance over time.
+     * Heap tracking is lock-free: every registered thread only bumps its own relaxed counters, using the size reported
+     * by the allocator for the block, and the per-thread counters are only summed when a metric is read.
+     * @note Blocks freed by a different thread than the one that allocated them count against the freeing thread,
+     *       so per-thread current bytes are approximate while the global figures stay exact.
      */
     class RM_API Metrics {
         public:
@@ -36,17 +40,36 @@ namespace rome::core {
         void stop();
 
         /**
-         * @brief Registers a heap memory allocation.
+         * @brief Registers a heap memory allocation made by the current thread, if it is tracking memory.
          * @param ptr The pointer returned by the underlying allocation.
-         * @param size The number of bytes requested.
+         * @param size The usable size of the allocated block in bytes.
+         * @note This function is thread-safe and lock-free.
          */
-        void registerAllocation(void* ptr, u64 size);
+        void registerAllocation(void* ptr, u64 size) noexcept;
 
         /**
-         * @brief Registers a heap memory free operation.
+         * @brief Registers a heap memory free made by the current thread, if it is tracking memory.
          * @param ptr The pointer being freed.
+         * @param size The usable size of the freed block in bytes.
+         * @note This function is thread-safe and lock-free.
          */
-        void registerDeallocation(void* ptr);
+        void registerDeallocation(void* ptr, u64 size) noexcept;
+
+        /**
+         * @brief Registers how many bytes of frame arena scratch memory a thread's arena used in a frame.
+         * @param thread The thread owning the arena.
+         * @param bytes The bytes the arena used.
+         * @note This function is thread-safe. Does nothing if the thread is unregistered.
+         */
+        void registerArenaFrame(const UUID& thread, u64 bytes) noexcept;
+
+        /**
+         * @brief Registers the events a bounded event queue dropped or spilled over a frame, on the thread swapping it.
+         * @param dropped The events that were discarded.
+         * @param spilled The events that went past the queue's capacity into heap memory.
+         * @note This function is thread-safe and lock-free. Does nothing if the current thread is unregistered.
+         */
+        void registerEventOverflow(u64 dropped, u64 spilled) noexcept;
 
         /**
          * @brief Logs the current metrics for all threads.
@@ -167,6 +190,57 @@ namespace rome::core {
          */
         u64 getGlobalMissingDeallocations() const;
 
+        /**
+         * @brief Gets the most memory the given thread's frame arenas have used in a single frame.
+         * @param thread The thread to get the memory metrics for.
+         * @return The frame arena high-water mark in bytes.
+         */
+        u64 getArenaPeakBytes(const UUID& thread) const;
+        /**
+         * @brief Gets the most memory the current thread's frame arenas have used in a single frame.
+         * @return The frame arena high-water mark in bytes.
+         */
+        u64 getArenaPeakBytes() const;
+        /**
+         * @brief Gets the most memory any tracked thread's frame arenas have used in a single frame.
+         * @return The frame arena high-water mark in bytes.
+         */
+        u64 getGlobalArenaPeakBytes() const;
+
+        /**
+         * @brief Gets the number of events bounded queues swapped by the given thread have dropped.
+         * @param thread The thread to get the metrics for.
+         * @return The number of dropped events.
+         */
+        u64 getDroppedEvents(const UUID& thread) const;
+        /**
+         * @brief Gets the number of events bounded queues swapped by the current thread have dropped.
+         * @return The number of dropped events.
+         */
+        u64 getDroppedEvents() const;
+        /**
+         * @brief Gets the number of events bounded queues swapped by any tracked thread have dropped.
+         * @return The number of dropped events.
+         */
+        u64 getGlobalDroppedEvents() const;
+
+        /**
+         * @brief Gets the number of events bounded queues swapped by the given thread have spilled to the heap.
+         * @param thread The thread to get the metrics for.
+         * @return The number of spilled events.
+         */
+        u64 getSpilledEvents(const UUID& thread) const;
+        /**
+         * @brief Gets the number of events bounded queues swapped by the current thread have spilled to the heap.
+         * @return The number of spilled events.
+         */
+        u64 getSpilledEvents() const;
+        /**
+         * @brief Gets the number of events bounded queues swapped by any tracked thread have spilled to the heap.
+         * @return The number of spilled events.
+         */
+        u64 getGlobalSpilledEvents() const;
+
         /**
          * @brief Gets whether memory tracking is enabled for the given thread.
          * @param thread The thread to check.
@@ -214,17 +288,34 @@ namespace rome::core {
         b8 isRegistered() const;
 
         private:
+        /**
+         * @brief Heap counters of a single thread. Only the owning thread writes them, so plain relaxed stores suffice.
+         */
         struct ThreadMetrics {
-            rome::u64 currentBytes = 0;                        ///< The current total heap-allocated bytes.
-            rome::u64 peakBytes = 0;                           ///< The maximum number of bytes allocated during program execution.
-            rome::u64 totalBytes = 0;                          ///< The total number of bytes allocated during program execution.
-            rome::u64 totalAllocations = 0;                    ///< The total number of heap allocations.
-            rome::b8 memoryLogging = false;                    ///< Whether to log memory allocation and deallocation.
-            std::string alias = "Main";                        ///< The alias for this thread.
-            std::unordered_map<void*, rome::u64> allocations;  ///< Tracks each pointer's allocated size.
+            std::atomic<u64> allocatedBytes = 0;    ///< The total number of bytes allocated during program execution.
+            std::atomic<u64> freedBytes = 0;        ///< The total number of bytes freed during program execution.
+            std::atomic<u64> peakBytes = 0;         ///< The maximum number of bytes allocated at once.
+            std::atomic<u64> allocations = 0;       ///< The total number of heap allocations.
+            std::atomic<u64> deallocations = 0;     ///< The total number of heap deallocations.
+            std::atomic<u64> arenaPeakBytes = 0;    ///< The most one of this thread's frame arenas used in a frame, see registerArenaFrame.
+            std::atomic<u64> droppedEvents = 0;     ///< The events dropped by the bounded queues this thread swapped.
+            std::atomic<u64> spilledEvents = 0;     ///< The events spilled by the bounded queues this thread swapped.
+            std::atomic<b8> memoryLogging = false;  ///< Whether to track memory allocation and deallocation.
+            std::string alias = "Main";             ///< The alias for this thread.
+
+            /**
+             * @brief Gets the number of bytes currently allocated.
+             * @return The allocated bytes minus the freed bytes, clamped to zero.
+             */
+            inline u64 getCurrentBytes() const noexcept {
+                const u64 allocated = allocatedBytes.load(std::memory_order_relaxed);
+                const u64 freed = freedBytes.load(std::memory_order_relaxed);
+                return allocated > freed ? allocated - freed : 0;
+            }
         };
 
-        mutable std::mutex registrarMutex;                       ///< Protects allocations and the counters from concurrent access.
+        static thread_local ThreadMetrics* local;                ///< The metrics of the current thread, null if unregistered.
+        mutable std::mutex registrarMutex;                       ///< Protects the thread registry from concurrent access.
         std::unordered_map<UUID, ThreadMetrics*> threadMetrics;  ///< The metrics for each thread.
     };
 }  // namespace rome::core
\ No newline at end of file
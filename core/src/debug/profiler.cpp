@@ -0,0 +1,139 @@
+#include "debug/profiler.hpp"
+
+#include <bit>
+#include <fstream>
+
+#include "concurrency/thread.hpp"
+#include "platform/platform.hpp"
+
+namespace rome::core {
+    thread_local Profiler::Buffer* Profiler::local = nullptr;
+
+    Profiler::Zone::Zone(const char* name) noexcept
+        : name(Profiler::getInstance().isRecording() ? name : nullptr), begin(this->name ? Platform::getInstance().timeNS() : 0) {}
+
+    Profiler::Zone::~Zone() {
+        if (name) {
+            Profiler::getInstance().record(name, begin, Platform::getInstance().timeNS());
+        }
+    }
+
+    void Profiler::start() noexcept { recording.store(true, std::memory_order_relaxed); }
+
+    void Profiler::stop() noexcept { recording.store(false, std::memory_order_relaxed); }
+
+    void Profiler::record(const char* name, u64 begin, u64 end) noexcept { push(Event{name, begin, end, false}); }
+
+    void Profiler::mark(const char* name) noexcept {
+        if (!isRecording()) {
+            return;
+        }
+        const u64 now = Platform::getInstance().timeNS();
+        push(Event{name, now, now, true});
+    }
+
+    void Profiler::setCapacity(u64 capacity) noexcept { this->capacity.store(std::bit_ceil(std::max<u64>(capacity, 1))); }
+
+    void Profiler::clear() noexcept {
+        std::lock_guard guard(buffersLock);
+        for (Unique<Buffer>& buffer : buffers) {
+            buffer->head.store(0, std::memory_order_release);
+        }
+    }
+
+    u64 Profiler::getEventCount() const {
+        std::lock_guard guard(buffersLock);
+        u64 count = 0;
+        for (const Unique<Buffer>& buffer : buffers) {
+            count += std::min(buffer->head.load(std::memory_order_acquire), buffer->capacity);
+        }
+        return count;
+    }
+
+    std::string Profiler::exportTrace() const {
+        std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        b8 first = true;
+        auto append = [&](const std::string& event) {
+            if (!first) json += ",";
+            json += "\n" + event;
+            first = false;
+        };
+        auto escape = [](const char* name) {
+            std::string escaped;
+            for (const char* c = name; *c; c++) {
+                if (*c == '"' || *c == '\\') escaped += '\\';
+                escaped += *c;
+            }
+            return escaped;
+        };
+        auto micros = [](u64 ns) { return std::to_string(ns / 1000) + "." + std::to_string(1000 + ns % 1000).substr(1); };
+
+        std::lock_guard guard(buffersLock);
+        for (const Unique<Buffer>& buffer : buffers) {
+            const std::string tid = std::to_string(buffer->tid);
+            append(R"({"name":"thread_name","ph":"M","pid":0,"tid":)" + tid + R"(,"args":{"name":")" + escape(buffer->alias.c_str()) +
+                   "\"}}");
+
+            const u64 head = buffer->head.load(std::memory_order_acquire);
+            const u64 count = std::min(head, buffer->capacity);
+            std::vector<Event> events(count);
+            for (u64 i = 0; i < count; i++) {
+                events[i] = buffer->events[(head - count + i) & (buffer->capacity - 1)];
+            }
+            // The owner may have lapped the oldest copied events while they were being read, including the one in flight
+            const u64 after = buffer->head.load(std::memory_order_acquire) + 1;
+            const u64 safe = after > buffer->capacity ? after - buffer->capacity : 0;
+
+            for (u64 i = safe > head - count ? std::min(safe - (head - count), count) : 0; i < count; i++) {
+                const Event& event = events[i];
+                if (event.frame) {
+                    append(R"({"name":")" + escape(event.name) + R"(","cat":"frame","ph":"i","s":"t","pid":0,"tid":)" + tid +
+                           R"(,"ts":)" + micros(event.begin) + "}");
+                } else {
+                    append(R"({"name":")" + escape(event.name) + R"(","cat":"zone","ph":"X","pid":0,"tid":)" + tid + R"(,"ts":)" +
+                           micros(event.begin) + R"(,"dur":)" + micros(event.end - event.begin) + "}");
+                }
+            }
+        }
+        return json + "\n]}\n";
+    }
+
+    b8 Profiler::exportTrace(const std::string& path) const {
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+        file << exportTrace();
+        return file.good();
+    }
+
+    Profiler::Buffer* Profiler::acquire() noexcept {
+        if (!local) {
+            try {
+                Unique<Buffer> buffer = MakeUnique<Buffer>();
+                buffer->alias = ThreadInfo::getLocalAlias();
+                buffer->capacity = capacity.load();
+                buffer->events = MakeUnique<Event[]>(buffer->capacity);
+
+                std::lock_guard guard(buffersLock);
+                buffer->tid = static_cast<u32>(buffers.size());
+                buffers.push_back(std::move(buffer));
+                local = buffers.back().get();
+            } catch (...) {
+                // Out of memory: the next event tries again
+                return nullptr;
+            }
+        }
+        return local;
+    }
+
+    void Profiler::push(const Event& event) noexcept {
+        Buffer* buffer = acquire();
+        if (!buffer) {
+            return;
+        }
+        const u64 head = buffer->head.load(std::memory_order_relaxed);
+        buffer->events[head & (buffer->capacity - 1)] = event;
+        buffer->head.store(head + 1, std::memory_order_release);
+    }
+}  // namespace rome::core
\ No newline at end of file
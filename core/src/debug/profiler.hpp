@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief Records timed CPU zones and frame markers into per-thread ring buffers, exportable as a Chrome trace.
+     * Every thread writes to its own buffer without locking; once full, a buffer overwrites its oldest events, so a
+     * capture always holds the most recent frames. The export can be opened in Perfetto or chrome://tracing.
+     * @note Instrument code with RM_PROFILE_SCOPE / RM_PROFILE_FUNCTION / RM_PROFILE_FRAME, which compile to nothing
+     *       unless RM_PROFILE_ON is defined.
+     */
+    class RM_API Profiler final {
+        public:
+        static constexpr u64 DefaultCapacity = 1 << 16;  ///< The default number of events kept per thread.
+
+        /**
+         * @brief A scope timed from construction to destruction.
+         */
+        class RM_API Zone final {
+            public:
+            /**
+             * @brief Opens a zone, if the profiler is recording.
+             * @param name The name of the zone. Must outlive the profiler, typically a string literal.
+             */
+            explicit Zone(const char* name) noexcept;
+            ~Zone();
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+            Zone(Zone&&) = delete;
+            Zone& operator=(Zone&&) = delete;
+
+            private:
+            const char* name;  ///< The name of the zone, null if the profiler was not recording when the zone opened.
+            u64 begin;         ///< The time the zone opened in nanoseconds.
+        };
+
+        Profiler() = default;
+        ~Profiler() = default;
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        Profiler& operator=(Profiler&&) = delete;
+
+        /**
+         * @brief Gets the singleton instance of the profiler.
+         * @return The profiler instance.
+         */
+        static Profiler& getInstance() {
+            static Profiler instance;
+            return instance;
+        }
+
+        /**
+         * @brief Starts recording zones and frame markers.
+         */
+        void start() noexcept;
+
+        /**
+         * @brief Stops recording. Zones still open keep their begin time and are recorded when they close.
+         */
+        void stop() noexcept;
+
+        /**
+         * @brief Checks whether the profiler is recording.
+         * @return True if the profiler is recording, false otherwise.
+         */
+        inline b8 isRecording() const noexcept { return recording.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Records a finished zone on the current thread's buffer.
+         * @param name The name of the zone.
+         * @param begin The time the zone opened in nanoseconds.
+         * @param end The time the zone closed in nanoseconds.
+         * @note This function is thread-safe and lock-free once the thread has recorded its first event. The event is
+         *       dropped if the thread's buffer cannot be allocated.
+         */
+        void record(const char* name, u64 begin, u64 end) noexcept;
+
+        /**
+         * @brief Records a frame marker on the current thread's buffer, if the profiler is recording.
+         * @param name The name of the frame, e.g. "Tick" or "Render".
+         * @note This function is thread-safe and lock-free once the thread has recorded its first event. The marker is
+         *       dropped if the thread's buffer cannot be allocated.
+         */
+        void mark(const char* name) noexcept;
+
+        /**
+         * @brief Sets the number of events kept by the buffers of threads that have not recorded anything yet.
+         * @param capacity The number of events per thread, rounded up to a power of two.
+         */
+        void setCapacity(u64 capacity) noexcept;
+
+        /**
+         * @brief Drops every recorded event.
+         * @warning Not thread-safe with respect to threads that are recording.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Gets the number of events currently held across every thread.
+         * @return The number of events.
+         */
+        u64 getEventCount() const;
+
+        /**
+         * @brief Exports the recorded events as Chrome trace-event JSON.
+         * @return The JSON document.
+         * @note Events overwritten while exporting are skipped, as is the oldest event of a full buffer since its owner may
+         *       be overwriting it. Export between frames for a consistent capture.
+         */
+        std::string exportTrace() const;
+
+        /**
+         * @brief Exports the recorded events as Chrome trace-event JSON into a file.
+         * @param path The path of the file to write.
+         * @return True if the file was written, false otherwise.
+         */
+        b8 exportTrace(const std::string& path) const;
+
+        private:
+        /**
+         * @brief A recorded zone or frame marker.
+         */
+        struct Event {
+            const char* name;  ///< The name of the zone or frame.
+            u64 begin;         ///< The time the zone opened or the frame began, in nanoseconds.
+            u64 end;           ///< The time the zone closed, equal to begin for frame markers.
+            b8 frame;          ///< Whether this is a frame marker.
+        };
+
+        /**
+         * @brief A single-writer ring of events owned by one thread.
+         */
+        struct Buffer {
+            std::string alias;         ///< The alias of the owning thread.
+            u32 tid;                   ///< The trace thread ID.
+            u64 capacity;              ///< The number of events, a power of two.
+            Unique<Event[]> events;    ///< The ring of events.
+            std::atomic<u64> head{0};  ///< The total number of events ever written.
+        };
+
+        static thread_local Buffer* local;           ///< The current thread's buffer, null until it records something.
+        std::atomic<b8> recording{false};            ///< Whether zones and frames are being recorded.
+        std::atomic<u64> capacity{DefaultCapacity};  ///< The capacity of newly created buffers.
+        mutable std::mutex buffersLock;              ///< Guards the list of buffers.
+        std::vector<Unique<Buffer>> buffers;         ///< Every buffer, in thread registration order.
+
+        /**
+         * @brief Gets the current thread's buffer, creating it on first use.
+         * Zones record from their destructor, so a failed allocation is swallowed rather than thrown.
+         * @return The current thread's buffer, or null if it could not be created.
+         */
+        Buffer* acquire() noexcept;
+
+        /**
+         * @brief Appends an event to the current thread's buffer, dropping it if the thread has no buffer.
+         * @param event The event to append.
+         */
+        void push(const Event& event) noexcept;
+    };
+}  // namespace rome::core
+
+#ifdef RM_PROFILE_ON
+#define RM_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RM_PROFILE_CONCAT(a, b) RM_PROFILE_CONCAT_IMPL(a, b)
+#define RM_PROFILE_SCOPE(name) rome::core::Profiler::Zone RM_PROFILE_CONCAT(rmProfileZone, __LINE__)(name)
+#define RM_PROFILE_FUNCTION() RM_PROFILE_SCOPE(__func__)
+#define RM_PROFILE_FRAME(name) rome::core::Profiler::getInstance().mark(name)
+#else
+#define RM_PROFILE_SCOPE(name)
+#define RM_PROFILE_FUNCTION()
+#define RM_PROFILE_FRAME(name)
+#endif
\ No newline at end of file
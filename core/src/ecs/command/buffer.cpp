@@ -0,0 +1,110 @@
+#include "ecs/command/buffer.hpp"
+
+namespace rome::core {
+    namespace Command {
+        std::atomic<u64> Queue::nextSerial{0};
+        thread_local std::vector<std::pair<u64, Buffer*>> Queue::bound;
+
+        void Buffer::playback(World& world, b8 archetypal) {
+            for (const Command& command : commands) {
+                apply(world, archetypal, command);
+            }
+            clear();
+        }
+
+        void Buffer::clear() {
+            for (const Command& command : commands) {
+                if (command.drop) command.drop(command.payload);
+            }
+            commands.clear();
+            entities.clear();
+            created = 0;
+            arena.reset();
+        }
+
+        void Buffer::apply(World& world, b8 archetypal, const Command& command) {
+            switch (command.type) {
+                case Type::Create:
+                    // Commands are applied in key order, which may differ from recording order across systems
+                    if (entities.size() <= command.pending) entities.resize(command.pending + 1);
+                    entities[command.pending] = world.entities.create();
+                    break;
+                case Type::Destroy:
+                    if (!world.entities.isAlive(*command.entity)) break;
+                    if (archetypal) {
+                        world.archetypes.destroy(*command.entity);
+                    } else {
+                        world.components.destroy(*command.entity);
+                    }
+                    world.entities.destroy(*command.entity);
+                    break;
+                case Type::Apply: {
+                    RM_ASSERT_MSG(command.entity || (command.pending < entities.size() && entities[command.pending]),
+                                  "Pending entity used before its creation was played back");
+                    const Entity& entity = command.entity ? *command.entity : *entities[command.pending];
+                    if (world.entities.isAlive(entity)) {
+                        command.apply(world, archetypal, entity, command.payload);
+                    }
+                    break;
+                }
+            }
+        }
+
+        Buffer& Queue::local() {
+            for (auto& [owner, buffer] : bound) {
+                if (owner == serial) {
+                    return *buffer;
+                }
+            }
+
+            Unique<Buffer> buffer = MakeUnique<Buffer>();
+            Buffer* local = buffer.get();
+            {
+                std::lock_guard guard(buffersLock);
+                buffers.push_back(std::move(buffer));
+            }
+            // Serials are never reused, so entries of destroyed queues never match again. An evicted queue keeps playing
+            // back the old buffer, the thread just records into a new one.
+            if (bound.size() >= MaxBound) {
+                bound.erase(bound.begin());
+            }
+            bound.emplace_back(serial, local);
+            return *local;
+        }
+
+        void Queue::playback(World& world) {
+            std::lock_guard guard(buffersLock);
+            order.clear();
+            for (u32 i = 0; i < buffers.size(); i++) {
+                for (u32 j = 0; j < buffers[i]->commands.size(); j++) {
+                    const Buffer::Command& command = buffers[i]->commands[j];
+                    order.push_back(Entry{command.key, command.position, i, j});
+                }
+            }
+            if (order.empty()) {
+                return;
+            }
+
+            // A task runs on a single thread, so the commands it recorded share a buffer and keep their recording order
+            std::ranges::stable_sort(order, [](const Entry& a, const Entry& b) {
+                return a.key != b.key ? a.key < b.key : a.position < b.position;
+            });
+            for (const Entry& entry : order) {
+                Buffer& buffer = *buffers[entry.buffer];
+                buffer.apply(world, archetypal, buffer.commands[entry.command]);
+            }
+            for (Unique<Buffer>& buffer : buffers) {
+                buffer->clear();
+            }
+        }
+
+        u64 Queue::getSize() const {
+            std::lock_guard guard(buffersLock);
+            u64 size = 0;
+            for (const Unique<Buffer>& buffer : buffers) {
+                size += buffer->getSize();
+            }
+            return size;
+        }
+    }  // namespace Command
+}  // namespace rome::core
\ No newline at end of file
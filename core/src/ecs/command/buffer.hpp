@@ -0,0 +1,322 @@
+#pragma once
+
+#include <limits>
+#include <optional>
+
+#include "ecs/world.hpp"
+#include "memory/arena.hpp"
+
+namespace rome::core {
+    namespace Command {
+        /**
+         * @brief Records structural changes (entity creation and destruction, component addition and removal) to apply later.
+         * Systems cannot touch the registries while other systems run, so they record their changes here instead and the
+         * scheduler plays them back once the stage is over. Component payloads are moved into an arena owned by the buffer.
+         * @warning A buffer is not thread-safe, use one per thread. See Queue.
+         */
+        class RM_API Buffer final {
+            public:
+            static constexpr u64 ArenaBlockSize = 1 << 16;  ///< The size of the blocks holding the component payloads.
+
+            /**
+             * @brief An entity that will be created when the buffer plays back.
+             */
+            struct Pending {
+                u64 index;  ///< The position of the entity among those created by the buffer.
+            };
+
+            /**
+             * @brief The slice of the playback order the commands of a piece of work go to: a key, then a position.
+             * Work handed to jobs records into sub-tasks carved out of its parent's slice, see split(), so the playback
+             * order follows the structure of the work rather than which thread ran which part of it.
+             */
+            struct Task {
+                u64 key = 0;                                 ///< The key of the commands, the ID of the system they come from.
+                u64 first = 0;                               ///< The position of the commands recorded by the task itself.
+                u64 last = std::numeric_limits<u64>::max();  ///< The last position the sub-tasks may take.
+
+                /**
+                 * @brief Carves a sub-task out of the positions following this task's own.
+                 * Sub-tasks play back in index order, after the commands the task recorded before splitting.
+                 * @param index The index of the sub-task.
+                 * @param count The number of sub-tasks the positions are shared between.
+                 * @return The sub-task.
+                 */
+                Task split(u64 index, u64 count) const noexcept {
+                    const u64 width = (last - first) / count;
+                    RM_ASSERT_MSG(width > 0, "Command tasks are nested too deeply to keep their playback order");
+                    return Task{key, first + 1 + index * width, first + (index + 1) * width};
+                }
+            };
+
+            /**
+             * @brief Makes a buffer record into a task until the scope ends, then restores the task it recorded into.
+             * Threads waiting on jobs run other jobs meanwhile, so every job scopes its task rather than setting it.
+             */
+            class Scope final {
+                public:
+                Scope(Buffer& buffer, const Task& task) noexcept : buffer(buffer), saved(buffer.task) {
+                    buffer.task = task;
+                    scopes++;
+                }
+                ~Scope() {
+                    buffer.task = saved;
+                    scopes--;
+                }
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+                Scope(Scope&&) = delete;
+                Scope& operator=(Scope&&) = delete;
+
+                private:
+                Buffer& buffer;    ///< The buffer recording into the task.
+                const Task saved;  ///< The task the buffer recorded into before.
+            };
+
+            Buffer() : arena(ArenaBlockSize) {}
+            ~Buffer() { clear(); }
+            Buffer(const Buffer&) = delete;
+            Buffer& operator=(const Buffer&) = delete;
+            Buffer(Buffer&&) = delete;
+            Buffer& operator=(Buffer&&) = delete;
+
+            /**
+             * @brief Records the creation of an entity.
+             * @return A handle to add components to the entity before it exists.
+             */
+            Pending create() {
+                commands.push_back(Command{Type::Create, std::nullopt, created, task.key, task.first});
+                return Pending{created++};
+            }
+
+            /**
+             * @brief Records the destruction of an entity along with all its components.
+             * @param entity The entity to destroy. Ignored on playback if it is already dead.
+             */
+            void destroy(const Entity& entity) { commands.push_back(Command{Type::Destroy, entity, 0, task.key, task.first}); }
+
+            /**
+             * @brief Records the addition of a component to an entity.
+             * @tparam T The component type to add.
+             * @param entity The entity to add the component to. Ignored on playback if it is dead by then.
+             * @param component The component to add, moved into the buffer.
+             */
+            template <Component::Component T>
+            void add(const Entity& entity, T component) {
+                record<T>(entity, 0, std::move(component));
+            }
+
+            /**
+             * @brief Records the addition of a component to an entity created by this buffer.
+             * @tparam T The component type to add.
+             * @param entity The pending entity to add the component to.
+             * @param component The component to add, moved into the buffer.
+             */
+            template <Component::Component T>
+            void add(Pending entity, T component) {
+                RM_ASSERT_MSG(entity.index < created, "Pending entity does not belong to this buffer");
+                record<T>(std::nullopt, entity.index, std::move(component));
+            }
+
+            /**
+             * @brief Records the removal of a component from an entity.
+             * @tparam T The component type to remove.
+             * @param entity The entity to remove the component from. Ignored on playback if it is dead or lacks the component.
+             */
+            template <Component::Component T>
+            void remove(const Entity& entity) {
+                commands.push_back(Command{Type::Apply, entity, 0, task.key, task.first, nullptr, &detach<T>, nullptr});
+            }
+
+            /**
+             * @brief Sets the key ordering the commands recorded from now on when a Queue plays back.
+             * @param key The key, lower keys play back first. The scheduler uses the ID of the running system.
+             */
+            inline void setKey(u64 key) noexcept { task = Task{key}; }
+
+            /**
+             * @brief Gets the task the commands are recorded into, to split it between jobs.
+             * @return The current task.
+             */
+            inline const Task& getTask() const noexcept { return task; }
+
+            /**
+             * @brief Checks whether the calling thread is inside a scoped task, i.e. runs a system or a batch of one of its
+             * parallel views.
+             * @return True if a Scope is alive on the calling thread, false otherwise.
+             */
+            static b8 isScoped() noexcept { return scopes > 0; }
+
+            /**
+             * @brief Sets the task the commands are recorded into from now on.
+             * @param task The task, e.g. the last sub-task of the current one once the others were handed to jobs.
+             */
+            inline void setTask(const Task& task) noexcept { this->task = task; }
+
+            /**
+             * @brief Gets the number of recorded commands.
+             * @return The number of commands.
+             */
+            inline u64 getSize() const noexcept { return commands.size(); }
+
+            /**
+             * @brief Checks whether no command is recorded.
+             * @return True if the buffer is empty, false otherwise.
+             */
+            inline b8 empty() const noexcept { return commands.empty(); }
+
+            /**
+             * @brief Applies every recorded command in recording order, then clears the buffer.
+             * @param world The world to apply the commands to.
+             * @param archetypal Whether the components live in the archetype storage rather than in the pools.
+             * @warning Nothing else may access the world meanwhile.
+             */
+            void playback(World& world, b8 archetypal = false);
+
+            /**
+             * @brief Drops every recorded command without applying it.
+             */
+            void clear();
+
+            private:
+            friend class Queue;
+
+            /**
+             * @brief The kind of a command.
+             */
+            enum class Type : u8 {
+                Create,   ///< Creates the pending entity.
+                Destroy,  ///< Destroys the entity.
+                Apply     ///< Calls a typed function on the entity, adding or removing a component.
+            };
+
+            /**
+             * @brief A recorded command.
+             */
+            struct Command {
+                Type type;                                                  ///< The kind of command.
+                std::optional<Entity> entity;                               ///< The target, empty when it is a pending entity.
+                u64 pending;                                                ///< The target pending entity, if entity is empty.
+                u64 key;                                                    ///< The key ordering the command across buffers.
+                u64 position;                                               ///< Orders the commands sharing a key.
+                void* payload = nullptr;                                    ///< The component to add, in the arena.
+                void (*apply)(World&, b8, const Entity&, void*) = nullptr;  ///< Applies the command to its target.
+                void (*drop)(void*) = nullptr;                              ///< Destroys the payload.
+            };
+
+            static inline thread_local u32 scopes = 0;    ///< The number of scopes alive on the current thread.
+            FrameArena arena;                             ///< Holds the component payloads until playback.
+            std::vector<Command> commands;                ///< The recorded commands, in recording order.
+            std::vector<std::optional<Entity>> entities;  ///< The entities created so far by the playback, by pending index.
+            u64 created = 0;                              ///< The number of pending entities.
+            Task task;                                    ///< The task the commands are being recorded into.
+
+            /**
+             * @brief Records the addition of a component.
+             * @tparam T The component type to add.
+             * @param entity The target, empty for a pending entity.
+             * @param pending The pending target, if entity is empty.
+             * @param component The component to move into the arena.
+             */
+            template <Component::Component T>
+            void record(std::optional<Entity> entity, u64 pending, T&& component) {
+                void* payload = new (arena.allocate(sizeof(T), alignof(T))) T(std::move(component));
+                commands.push_back(Command{Type::Apply, entity, pending, task.key, task.first, payload, &attach<T>, &release<T>});
+            }
+
+            /**
+             * @brief Applies one recorded command.
+             * @param world The world to apply the command to.
+             * @param archetypal Whether the components live in the archetype storage.
+             * @param command The command to apply.
+             */
+            void apply(World& world, b8 archetypal, const Command& command);
+
+            template <Component::Component T>
+            static void attach(World& world, b8 archetypal, const Entity& entity, void* payload) {
+                if (archetypal) {
+                    world.archetypes.create<T>(entity, std::move(*static_cast<T*>(payload)));
+                } else {
+                    world.components.create<T>(entity, std::move(*static_cast<T*>(payload)));
+                }
+            }
+
+            template <Component::Component T>
+            static void detach(World& world, b8 archetypal, const Entity& entity, void*) {
+                if (archetypal) {
+                    if (world.archetypes.has<T>(entity)) world.archetypes.remove<T>(entity);
+                } else if (world.components.has<T>(entity)) {
+                    world.components.remove<T>(entity);
+                }
+            }
+
+            template <Component::Component T>
+            static void release(void* payload) {
+                static_cast<T*>(payload)->~T();
+            }
+        };
+
+        /**
+         * @brief Hands every thread its own command buffer and plays them all back at a sync point.
+         * Playback is ordered by the task of every command, key first then position, then by recording order. The
+         * scheduler keys the commands of every system with its ID, and parallel views hand every batch a sub-task of the
+         * system's, so the outcome does not depend on which thread ran which system or batch.
+         * @note Jobs a system submits itself must scope the buffer of their thread to a sub-task, see Buffer::Scope,
+         *       or their commands land wherever the task their thread last recorded into was.
+         */
+        class RM_API Queue final {
+            public:
+            /**
+             * @brief Creates a queue.
+             * @param archetypal Whether the components live in the archetype storage rather than in the pools.
+             */
+            explicit Queue(b8 archetypal = false) : archetypal(archetypal), serial(nextSerial.fetch_add(1)) {}
+            ~Queue() = default;
+            Queue(const Queue&) = delete;
+            Queue& operator=(const Queue&) = delete;
+            Queue(Queue&&) = delete;
+            Queue& operator=(Queue&&) = delete;
+
+            /**
+             * @brief Gets the current thread's buffer, creating it on first use.
+             * @return The current thread's buffer.
+             * @note This function is thread-safe, and lock-free once the thread has a buffer.
+             */
+            Buffer& local();
+
+            /**
+             * @brief Applies the commands of every buffer in task order, then clears them.
+             * @param world The world to apply the commands to.
+             * @warning No thread may be recording meanwhile.
+             */
+            void playback(World& world);
+
+            /**
+             * @brief Gets the number of commands waiting across every buffer.
+             * @return The number of commands.
+             */
+            u64 getSize() const;
+
+            private:
+            /**
+             * @brief The position of a command in the playback order.
+             */
+            struct Entry {
+                u64 key;       ///< The key of the command.
+                u64 position;  ///< The position of the command within its key.
+                u32 buffer;    ///< The buffer holding the command.
+                u32 command;   ///< The position of the command in its buffer.
+            };
+
+            static constexpr u64 MaxBound = 16;  ///< The most queues a thread keeps a buffer for.
+
+            static std::atomic<u64> nextSerial;                              ///< The serial of the next queue.
+            static thread_local std::vector<std::pair<u64, Buffer*>> bound;  ///< The current thread's buffers, by queue serial.
+            const b8 archetypal;                                             ///< Whether the components live in the archetypes.
+            const u64 serial;                                                ///< Identifies the queue in the thread buffers.
+            mutable std::mutex buffersLock;                                  ///< Guards the list of buffers.
+            std::vector<Unique<Buffer>> buffers;                             ///< Every buffer, in thread registration order.
+            std::vector<Entry> order;                                        ///< The playback order, kept to reuse its memory.
+        };
+    }  // namespace Command
+}  // namespace rome::core
\ No newline at end of file
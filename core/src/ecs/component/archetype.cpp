@@ -0,0 +1,80 @@
+#include "ecs/component/archetype.hpp"
+
+namespace rome::core {
+    namespace Component {
+        Archetype::Archetype(const std::vector<ID>& ids, const std::vector<Layout>& layouts, u64 chunkSize)
+            : ids(ids), chunkAlign(alignof(Entity)) {
+            u64 rowBytes = sizeof(Entity);
+            for (u32 i = 0; i < ids.size(); i++) {
+                if (ids[i] >= columns.size()) {
+                    columns.resize(ids[i] + 1, npos);
+                }
+                columns[ids[i]] = i;
+                this->layouts.push_back(layouts[ids[i]]);
+                rowBytes += layouts[ids[i]].size;
+                chunkAlign = std::max(chunkAlign, layouts[ids[i]].align);
+            }
+
+            // Shrink the row count until the aligned columns fit in the chunk
+            auto place = [this](u64 rows) {
+                u64 cursor = rows * sizeof(Entity);
+                offsets.clear();
+                for (const Layout& layout : this->layouts) {
+                    cursor = (cursor + layout.align - 1) & ~(layout.align - 1);
+                    offsets.push_back(cursor);
+                    cursor += rows * layout.size;
+                }
+                return cursor;
+            };
+            capacity = std::max<u64>(chunkSize / rowBytes, 1);
+            while (capacity > 1 && place(capacity) > chunkSize) {
+                capacity--;
+            }
+            chunkBytes = std::max(place(capacity), chunkSize);
+        }
+
+        Archetype::~Archetype() {
+            for (u64 row = 0; row < size; row++) {
+                for (u32 column = 0; column < layouts.size(); column++) {
+                    layouts[column].destroy(get(column, row));
+                }
+            }
+            for (byte* chunk : chunks) {
+                ::operator delete(chunk, std::align_val_t(chunkAlign));
+            }
+        }
+
+        u64 Archetype::allocate(const Entity& entity) {
+            const u64 row = size;
+            if (row / capacity >= chunks.size()) {
+                chunks.push_back(static_cast<byte*>(::operator new(chunkBytes, std::align_val_t(chunkAlign))));
+            }
+            new (chunks[row / capacity] + (row % capacity) * sizeof(Entity)) Entity(entity);
+            size++;
+            return row;
+        }
+
+        const Entity* Archetype::release(u64 row) {
+            RM_ASSERT_MSG(row < size, "Archetype row out of range");
+            const u64 last = --size;
+            if (row == last) {
+                return nullptr;
+            }
+
+            for (u32 column = 0; column < layouts.size(); column++) {
+                layouts[column].relocate(get(column, row), get(column, last));
+            }
+            Entity* entities = reinterpret_cast<Entity*>(chunks[row / capacity]);
+            const Entity* moved = reinterpret_cast<const Entity*>(chunks[last / capacity]) + last % capacity;
+            new (entities + row % capacity) Entity(*moved);
+            return entities + row % capacity;
+        }
+
+        const Entity* Archetype::erase(u64 row) {
+            for (u32 column = 0; column < layouts.size(); column++) {
+                layouts[column].destroy(get(column, row));
+            }
+            return release(row);
+        }
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <new>
+
+#include "ecs/component/component.hpp"
+#include "ecs/entity/entity.hpp"
+
+namespace rome::core {
+    namespace Component {
+        /**
+         * @brief Type-erased description of how a component type is laid out and moved around in raw memory.
+         */
+        struct RM_API Layout {
+            u64 size = 0;                              ///< The size of the component in bytes.
+            u64 align = 1;                             ///< The alignment of the component in bytes.
+            void (*relocate)(void*, void*) = nullptr;  ///< Move-constructs at the first address from the second, destroying the source.
+            void (*destroy)(void*) = nullptr;          ///< Destroys the component at the given address.
+
+            /**
+             * @brief Builds the layout of a component type.
+             * @tparam T The component type.
+             * @return The layout of the component type.
+             */
+            template <Component T>
+            static Layout of() {
+                return Layout{sizeof(T), alignof(T),
+                              [](void* dst, void* src) {
+                                  new (dst) T(std::move(*static_cast<T*>(src)));
+                                  static_cast<T*>(src)->~T();
+                              },
+                              [](void* ptr) { static_cast<T*>(ptr)->~T(); }};
+            }
+        };
+
+        /**
+         * @brief Stores every entity sharing the same component signature in fixed-size chunks, one column per component.
+         * Rows are always densely packed: row r lives in chunk r / capacity, slot r % capacity.
+         * @warning This class is not thread-safe.
+         */
+        class RM_API Archetype final {
+            public:
+            static constexpr u32 npos = ~0u;  ///< Column index of a component that is not part of the archetype.
+
+            /**
+             * @brief Creates an archetype for the given components.
+             * @param ids The sorted IDs of the components in this archetype.
+             * @param layouts The layouts of every known component, indexed by component ID.
+             * @param chunkSize The target size of a chunk in bytes.
+             */
+            Archetype(const std::vector<ID>& ids, const std::vector<Layout>& layouts, u64 chunkSize);
+            ~Archetype();
+            Archetype(const Archetype&) = delete;
+            Archetype& operator=(const Archetype&) = delete;
+            Archetype(Archetype&&) = delete;
+            Archetype& operator=(Archetype&&) = delete;
+
+            /**
+             * @brief Appends a row for the given entity. The component columns of the row are left uninitialized.
+             * @param entity The entity owning the row.
+             * @return The index of the new row.
+             */
+            u64 allocate(const Entity& entity);
+
+            /**
+             * @brief Fills the hole left at a row by moving the last row into it.
+             * @param row The row whose components have already been destroyed or moved out.
+             * @return The entity that now lives at row, or nullptr if the released row was the last one.
+             */
+            const Entity* release(u64 row);
+
+            /**
+             * @brief Destroys the components of a row and releases it.
+             * @param row The row to erase.
+             * @return The entity that now lives at row, or nullptr if the erased row was the last one.
+             */
+            const Entity* erase(u64 row);
+
+            /**
+             * @brief Gets the address of a component in a row.
+             * @param column The column of the component.
+             * @param row The row to fetch.
+             * @return The address of the component.
+             */
+            inline void* get(u32 column, u64 row) noexcept {
+                return chunks[row / capacity] + offsets[column] + (row % capacity) * layouts[column].size;
+            }
+
+            /**
+             * @brief Destroys a single component of a row, leaving its slot uninitialized.
+             * @param column The column of the component.
+             * @param row The row holding the component.
+             */
+            inline void destroy(u32 column, u64 row) { layouts[column].destroy(get(column, row)); }
+
+            /**
+             * @brief Gets the start of a column inside a chunk.
+             * @param column The column to fetch.
+             * @param chunk The chunk to fetch.
+             * @return The address of the first component of the column in the chunk.
+             */
+            inline void* getColumn(u32 column, u64 chunk) noexcept { return chunks[chunk] + offsets[column]; }
+
+            /**
+             * @brief Gets the entities stored in a chunk.
+             * @param chunk The chunk to fetch.
+             * @return The address of the first entity of the chunk.
+             */
+            inline const Entity* getEntities(u64 chunk) const noexcept { return reinterpret_cast<const Entity*>(chunks[chunk]); }
+
+            /**
+             * @brief Finds the column holding a component.
+             * @param id The component ID.
+             * @return The column index, or npos if the component is not part of this archetype.
+             */
+            inline u32 find(ID id) const noexcept { return id < columns.size() ? columns[id] : npos; }
+
+            /**
+             * @brief Checks whether this archetype contains a component.
+             * @param id The component ID.
+             * @return True if the component is part of this archetype, false otherwise.
+             */
+            inline b8 contains(ID id) const noexcept { return find(id) != npos; }
+
+            /**
+             * @brief Gets the sorted IDs of the components in this archetype.
+             * @return The component IDs.
+             */
+            inline const std::vector<ID>& getIDs() const noexcept { return ids; }
+
+            /**
+             * @brief Gets the number of rows in this archetype.
+             * @return The number of rows.
+             */
+            inline u64 getSize() const noexcept { return size; }
+
+            /**
+             * @brief Gets the number of rows a chunk can hold.
+             * @return The chunk capacity in rows.
+             */
+            inline u64 getCapacity() const noexcept { return capacity; }
+
+            /**
+             * @brief Gets the number of chunks holding at least one row.
+             * @return The number of used chunks.
+             */
+            inline u64 getChunkCount() const noexcept { return (size + capacity - 1) / capacity; }
+
+            /**
+             * @brief Gets the number of rows stored in a chunk.
+             * @param chunk The chunk to query.
+             * @return The number of rows in the chunk.
+             */
+            inline u64 getChunkSize(u64 chunk) const noexcept { return std::min(capacity, size - chunk * capacity); }
+
+            /**
+             * @brief Caches the archetype reached by adding or removing a component.
+             * @param id The component ID.
+             * @param adding True for the add edge, false for the remove edge.
+             * @return A reference to the cached archetype, null if not yet resolved.
+             */
+            Archetype*& edge(ID id, b8 adding) { return adding ? adds[id] : removes[id]; }
+
+            private:
+            std::vector<ID> ids;                         ///< The sorted component IDs.
+            std::vector<u32> columns;                    ///< Maps component IDs to column indices.
+            std::vector<Layout> layouts;                 ///< The layout of each column.
+            std::vector<u64> offsets;                    ///< The byte offset of each column inside a chunk.
+            std::vector<byte*> chunks;                   ///< The allocated chunks.
+            std::unordered_map<ID, Archetype*> adds;     ///< Archetypes reached by adding a component.
+            std::unordered_map<ID, Archetype*> removes;  ///< Archetypes reached by removing a component.
+            u64 chunkBytes;                              ///< The size of a chunk in bytes.
+            u64 chunkAlign;                              ///< The alignment of a chunk in bytes.
+            u64 capacity;                                ///< The number of rows per chunk.
+            u64 size = 0;                                ///< The number of rows.
+        };
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "ecs/component/archetypes.hpp"
+
+namespace rome::core {
+    namespace Component {
+        Archetypes::Archetypes(Registry& registry, u64 chunkSize) : registry(registry), chunkSize(chunkSize) {}
+
+        void Archetypes::destroy(const Entity& entity) {
+            if (!locations.contains(entity.getIndex())) {
+                return;
+            }
+            const Location& location = locations[entity.getIndex()];
+            const Entity* moved = location.archetype->erase(location.row);
+            if (moved) {
+                locations[moved->getIndex()].row = location.row;
+            }
+            locations.erase(entity.getIndex());
+        }
+
+        Archetype* Archetypes::traverse(Archetype* from, ID id, b8 adding) {
+            Archetype*& cached = from ? from->edge(id, adding) : roots[id];
+            if (cached) {
+                return cached;
+            }
+
+            std::vector<ID> ids = from ? from->getIDs() : std::vector<ID>{};
+            if (adding) {
+                ids.insert(std::ranges::upper_bound(ids, id), id);
+            } else {
+                std::erase(ids, id);
+            }
+            if (ids.empty()) {
+                return nullptr;
+            }
+
+            auto it = signatures.find(ids);
+            if (it == signatures.end()) {
+                archetypes.push_back(MakeUnique<Archetype>(ids, layouts, chunkSize));
+                it = signatures.emplace(std::move(ids), archetypes.back().get()).first;
+            }
+            cached = it->second;
+            return cached;
+        }
+
+        u64 Archetypes::migrate(const Entity& entity, Archetype* from, Archetype* to) {
+            u64 row = 0;
+            if (to) {
+                row = to->allocate(entity);
+            }
+
+            if (from) {
+                const u64 old = locations[entity.getIndex()].row;
+                for (ID id : from->getIDs()) {
+                    if (to && to->contains(id)) {
+                        layouts[id].relocate(to->get(to->find(id), row), from->get(from->find(id), old));
+                    }
+                }
+                const Entity* moved = from->release(old);
+                if (moved) {
+                    locations[moved->getIndex()].row = old;
+                }
+            }
+
+            if (to) {
+                if (locations.contains(entity.getIndex())) {
+                    locations[entity.getIndex()] = Location{to, row};
+                } else {
+                    locations.insert(entity.getIndex(), Location{to, row});
+                }
+            } else {
+                locations.erase(entity.getIndex());
+            }
+            return row;
+        }
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
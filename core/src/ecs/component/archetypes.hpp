@@ -0,0 +1,226 @@
+#pragma once
+
+#include <map>
+
+#include "ecs/component/archetype.hpp"
+#include "ecs/component/registry.hpp"
+
+namespace rome::core {
+    namespace Component {
+        /**
+         * @brief Archetype storage backend: groups entities by component signature into chunked column storage.
+         * An alternative to the per-type pools of the component registry, trading slower structural changes
+         * for linear, cache-friendly multi-component queries.
+         * @note Component IDs and names are still owned by the component registry.
+         * @warning This storage is not thread-safe.
+         */
+        class RM_API Archetypes final {
+            public:
+            static constexpr u64 DefaultChunkSize = 16 * 1024;  ///< Default chunk size in bytes.
+
+            /**
+             * @brief Creates an archetype storage.
+             * @param registry The component registry handing out component IDs.
+             * @param chunkSize The size of every chunk in bytes.
+             */
+            explicit Archetypes(Registry& registry, u64 chunkSize = DefaultChunkSize);
+            ~Archetypes() = default;
+            Archetypes(const Archetypes&) = delete;
+            Archetypes& operator=(const Archetypes&) = delete;
+            Archetypes(Archetypes&&) = delete;
+            Archetypes& operator=(Archetypes&&) = delete;
+
+            /**
+             * @brief Creates a new component for the given entity, moving the entity to its new archetype.
+             * @tparam T The component type to create.
+             * @tparam Args The types of the arguments to forward to the component constructor.
+             * @param entity The entity to create the component for.
+             * @param ...args The arguments to forward to the component constructor.
+             * @return The created component, or the existing one if the entity already has it.
+             */
+            template <Component T, typename... Args>
+            T& create(const Entity& entity, Args&&... args) {
+                const ID id = enter<T>();
+                Archetype* from = locations.contains(entity.getIndex()) ? locations[entity.getIndex()].archetype : nullptr;
+                if (from && from->contains(id)) {
+                    RM_WARN("Entity already has component of type: %s", Reflect::reflect<T>().getType().getName().c_str());
+                    return *static_cast<T*>(from->get(from->find(id), locations[entity.getIndex()].row));
+                }
+
+                Archetype* to = traverse(from, id, true);
+                const u64 row = migrate(entity, from, to);
+                return *new (to->get(to->find(id), row)) T(std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Removes a component from a given entity, moving the entity to its new archetype.
+             * @tparam T The component type.
+             * @param entity The entity to remove the component from.
+             */
+            template <Component T>
+            void remove(const Entity& entity) {
+                const ID id = enter<T>();
+                if (!has<T>(entity)) {
+                    RM_WARN("Entity does not have component of type: %s", Reflect::reflect<T>().getType().getName().c_str());
+                    return;
+                }
+
+                Archetype* from = locations[entity.getIndex()].archetype;
+                from->destroy(from->find(id), locations[entity.getIndex()].row);
+                migrate(entity, from, traverse(from, id, false));
+            }
+
+            /**
+             * @brief Gets the component for the given entity.
+             * @tparam T The component type to get.
+             * @param entity The entity to get the component for.
+             * @return The component for the given entity.
+             */
+            template <Component T>
+            T& get(const Entity& entity) {
+                RM_ASSERT_MSG(has<T>(entity), "Entity does not have component T");
+                const Location& location = locations[entity.getIndex()];
+                return *static_cast<T*>(location.archetype->get(location.archetype->find(enter<T>()), location.row));
+            }
+
+            /**
+             * @brief Checks whether the given entity has a component.
+             * @tparam T The component type to check.
+             * @param entity The entity to check.
+             * @return True if the entity has the component, false otherwise.
+             */
+            template <Component T>
+            b8 has(const Entity& entity) {
+                return locations.contains(entity.getIndex()) && locations[entity.getIndex()].archetype->contains(enter<T>());
+            }
+
+            /**
+             * @brief Destroys every component of the given entity.
+             * @param entity The entity to clear.
+             */
+            void destroy(const Entity& entity);
+
+            /**
+             * @brief Calls a function for every entity owning all the given components, walking matching chunks linearly.
+             * @tparam Ts The component types to fetch. Const-qualify read-only components.
+             * @tparam Function The type of the function, invocable with (Ts&...).
+             * @param function The function to call.
+             */
+            template <Component... Ts, typename Function>
+            void each(Function&& function) {
+                const std::array<ID, sizeof...(Ts)> ids{enter<remove_all_qualifiers_t<Ts>>()...};
+                match(ids, {}, [&](Archetype& archetype) {
+                    std::array<u32, sizeof...(Ts)> columns;
+                    std::ranges::transform(ids, columns.begin(), [&](ID id) { return archetype.find(id); });
+                    for (u64 chunk = 0; chunk < archetype.getChunkCount(); chunk++) {
+                        walk<Ts...>(archetype, columns, chunk, function, std::index_sequence_for<Ts...>{});
+                    }
+                });
+            }
+
+            /**
+             * @brief Calls a function for every non-empty archetype holding all the required components and none of the excluded ones.
+             * @tparam Function The type of the function, invocable with (Archetype&).
+             * @param required The IDs of the components an archetype must hold.
+             * @param excluded The IDs of the components an archetype must not hold.
+             * @param function The function to call.
+             */
+            template <typename Function>
+            void match(std::span<const ID> required, std::span<const ID> excluded, Function&& function) const {
+                for (const Unique<Archetype>& archetype : archetypes) {
+                    if (archetype->getSize() == 0 || !std::ranges::all_of(required, [&](ID id) { return archetype->contains(id); }) ||
+                        std::ranges::any_of(excluded, [&](ID id) { return archetype->contains(id); })) {
+                        continue;
+                    }
+                    function(*archetype);
+                }
+            }
+
+            /**
+             * @brief Gets the number of archetypes created so far.
+             * @return The number of archetypes.
+             */
+            inline u64 getArchetypeCount() const noexcept { return archetypes.size(); }
+
+            /**
+             * @brief Gets the chunk size in bytes.
+             * @return The chunk size.
+             */
+            inline u64 getChunkSize() const noexcept { return chunkSize; }
+
+            private:
+            /**
+             * @brief Where an entity's components live.
+             */
+            struct Location {
+                Archetype* archetype;  ///< The archetype holding the entity.
+                u64 row;               ///< The entity's row in the archetype.
+            };
+
+            Registry& registry;                                ///< The registry handing out component IDs.
+            const u64 chunkSize;                               ///< The size of every chunk in bytes.
+            std::vector<Layout> layouts;                       ///< Component layouts indexed by component ID.
+            std::vector<Unique<Archetype>> archetypes;         ///< Every archetype, in creation order.
+            std::map<std::vector<ID>, Archetype*> signatures;  ///< Maps sorted component IDs to their archetype.
+            std::unordered_map<ID, Archetype*> roots;          ///< Archetypes reached by adding a component to an empty entity.
+            SparseSet<Location> locations;                     ///< Maps entity indices to their location.
+
+            /**
+             * @brief Gets the ID of a component type, recording its layout on first use.
+             * @tparam T The component type.
+             * @return The ID of the component type.
+             */
+            template <Component T>
+            ID enter() {
+                const ID id = registry.enter<T>();
+                if (id >= layouts.size()) {
+                    layouts.resize(id + 1);
+                }
+                if (!layouts[id].relocate) {
+                    layouts[id] = Layout::of<T>();
+                }
+                return id;
+            }
+
+            /**
+             * @brief Resolves the archetype reached by adding or removing a component, creating it if needed.
+             * @param from The current archetype, null for an entity without components.
+             * @param id The component to add or remove.
+             * @param adding True to add the component, false to remove it.
+             * @return The target archetype, null if it has no components.
+             */
+            Archetype* traverse(Archetype* from, ID id, b8 adding);
+
+            /**
+             * @brief Moves an entity's row between archetypes, relocating the components both archetypes share.
+             * @param entity The entity to move.
+             * @param from The current archetype, null for an entity without components.
+             * @param to The target archetype, null to drop the entity from the storage.
+             * @return The entity's row in the target archetype.
+             * @warning Components only present in "from" must already be destroyed, and components only present in "to"
+             *          are left uninitialized.
+             */
+            u64 migrate(const Entity& entity, Archetype* from, Archetype* to);
+
+            /**
+             * @brief Calls a function for every row in a chunk.
+             * @tparam Ts The component types to fetch.
+             * @tparam Function The type of the function.
+             * @tparam I The indices of the component types.
+             * @param archetype The archetype holding the chunk.
+             * @param columns The column of each component type.
+             * @param chunk The chunk to walk.
+             * @param function The function to call.
+             */
+            template <typename... Ts, typename Function, std::size_t... I>
+            static void walk(Archetype& archetype, const std::array<u32, sizeof...(Ts)>& columns, u64 chunk, Function& function,
+                             std::index_sequence<I...>) {
+                const u64 count = archetype.getChunkSize(chunk);
+                const std::tuple<Ts*...> data{static_cast<Ts*>(archetype.getColumn(columns[I], chunk))...};
+                for (u64 row = 0; row < count; row++) {
+                    function(std::get<I>(data)[row]...);
+                }
+            }
+        };
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
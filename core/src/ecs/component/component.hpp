@@ -1,11 +1,17 @@
 #pragma once
 
+#include "container/bitset.hpp"
 #include "reflection/reflect.hpp"
 
 namespace rome::core {
     namespace Component {
         using ID = u32;
 
+        /**
+         * @brief The set of components an entity has, indexed by component ID. The first 64 component types fit inline.
+         */
+        using Signature = BitSet<ID, 64>;
+
         template <typename T>
         concept Component = std::copy_constructible<T> && requires { Reflect::reflect<T>(); };
     }  // namespace Component
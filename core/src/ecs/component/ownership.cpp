@@ -0,0 +1,63 @@
+#include "ecs/component/ownership.hpp"
+
+namespace rome::core {
+    namespace Component {
+        Ownership::Ownership(const std::vector<ID>& owned, const std::vector<Storage*>& ownedStorages, const std::vector<ID>& observed,
+                             const std::vector<Storage*>& observedStorages, std::span<const Signature> signatures)
+            : owned(owned), ownedStorages(ownedStorages), observed(observed), observedStorages(observedStorages) {
+            RM_ASSERT_MSG(!owned.empty() || !observed.empty(), "An ownership must track at least one component");
+            for (ID id : owned) {
+                mask.set(id);
+            }
+            for (ID id : observed) {
+                mask.set(id);
+            }
+
+            const std::span<const u64> lead = (owned.empty() ? observedStorages : ownedStorages).front()->getIndices();
+            const std::vector<u64> candidates(lead.begin(), lead.end());
+            for (u64 index : candidates) {
+                enter(index, signatures[index]);
+            }
+        }
+
+        void Ownership::enter(u64 index, const Signature& signature) {
+            if (!signature.includes(mask) || contains(index)) {
+                return;
+            }
+
+            if (owned.empty()) {
+                members.insert(index, 0);
+            }
+            for (Storage* storage : ownedStorages) {
+                storage->swap(index, storage->getIndices()[length]);
+            }
+            length++;
+        }
+
+        void Ownership::leave(u64 index) {
+            if (!contains(index)) {
+                return;
+            }
+
+            length--;
+            if (owned.empty()) {
+                members.erase(index);
+            }
+            for (Storage* storage : ownedStorages) {
+                storage->swap(index, storage->getIndices()[length]);
+            }
+        }
+
+        b8 Ownership::contains(u64 index) const noexcept {
+            if (owned.empty()) {
+                return members.contains(index);
+            }
+            const Storage* lead = ownedStorages.front();
+            return lead->contains(index) && lead->getPosition(index) < length;
+        }
+
+        std::span<const u64> Ownership::getIndices() const noexcept {
+            return owned.empty() ? members.getIndices() : ownedStorages.front()->getIndices().first(length);
+        }
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
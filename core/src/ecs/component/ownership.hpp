@@ -0,0 +1,97 @@
+#pragma once
+
+#include "ecs/component/pool.hpp"
+
+namespace rome::core {
+    namespace Component {
+        /**
+         * @brief Keeps every entity that has a set of components packed at the front of the owned components' pools.
+         * Members of the set occupy the same prefix [0, length) of every owned pool, in the same order, so they can be
+         * walked in lockstep without sparse lookups. Observed components are required for membership but not packed.
+         * An ownership without owned components only observes: its members are kept in a separate set instead.
+         * @note Owned pools may only be owned by one ownership at a time.
+         * @warning This class is not thread-safe.
+         */
+        class RM_API Ownership final {
+            public:
+            /**
+             * @brief Creates an ownership over the given pools and packs the entities already matching it.
+             * @param owned The IDs of the owned components.
+             * @param ownedStorages The pools of the owned components, in the same order.
+             * @param observed The IDs of the observed components.
+             * @param observedStorages The pools of the observed components, in the same order.
+             * @param signatures The signature of every entity, by entity index.
+             */
+            Ownership(const std::vector<ID>& owned, const std::vector<Storage*>& ownedStorages, const std::vector<ID>& observed,
+                      const std::vector<Storage*>& observedStorages, std::span<const Signature> signatures);
+            ~Ownership() = default;
+            Ownership(const Ownership&) = delete;
+            Ownership& operator=(const Ownership&) = delete;
+            Ownership(Ownership&&) = delete;
+            Ownership& operator=(Ownership&&) = delete;
+
+            /**
+             * @brief Packs an entity into the owned prefix if it now has every owned and observed component.
+             * @param index The index of the entity that just received a component.
+             * @param signature The entity's components, including the one just received.
+             */
+            void enter(u64 index, const Signature& signature);
+
+            /**
+             * @brief Moves an entity out of the owned prefix if it is a member.
+             * @param index The index of the entity about to lose a component.
+             */
+            void leave(u64 index);
+
+            /**
+             * @brief Checks whether an entity is a member.
+             * @param index The entity index.
+             * @return True if the entity sits in the owned prefix, false otherwise.
+             */
+            b8 contains(u64 index) const noexcept;
+
+            /**
+             * @brief Checks whether a component affects membership.
+             * @param id The component ID.
+             * @return True if the component is owned or observed, false otherwise.
+             */
+            inline b8 isTracking(ID id) const noexcept { return mask.test(id); }
+
+            /**
+             * @brief Gets the indices of the member entities, in packed order.
+             * @return A span over the member indices, identical across every owned pool.
+             */
+            std::span<const u64> getIndices() const noexcept;
+
+            /**
+             * @brief Gets the number of member entities.
+             * @return The length of the owned prefix.
+             */
+            inline u64 getLength() const noexcept { return length; }
+
+            /**
+             * @brief Gets the owned component IDs.
+             * @return The owned component IDs.
+             */
+            inline const std::vector<ID>& getOwned() const noexcept { return owned; }
+
+            /**
+             * @brief Gets the observed component IDs.
+             * @return The observed component IDs.
+             */
+            inline const std::vector<ID>& getObserved() const noexcept { return observed; }
+
+            private:
+            friend class Registry;
+
+            const std::vector<ID> owned;                   ///< The owned component IDs.
+            const std::vector<Storage*> ownedStorages;     ///< The owned pools, packed in lockstep.
+            const std::vector<ID> observed;                ///< The observed component IDs.
+            const std::vector<Storage*> observedStorages;  ///< The observed pools, only checked for membership.
+            Signature mask;                                ///< Every owned and observed component.
+            SparseSet<u8> members;                         ///< The member entities, only used when nothing is owned.
+            u64 length = 0;                                ///< The number of member entities.
+            u64 holders = 0;                               ///< The number of own() calls not released yet.
+        };
+    }  // namespace Component
+}  // namespace rome::core
\ No newline at end of file
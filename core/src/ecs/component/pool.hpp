@@ -15,6 +15,47 @@ namespace rome::core {
         class RM_API Storage {
             public:
             virtual ~Storage() = default;
+
+            /**
+             * @brief Checks whether the entity at the given index has a component in this storage.
+             * @param index The entity index to check.
+             * @return True if the entity has a component in this storage, false otherwise.
+             */
+            virtual b8 contains(u64 index) const noexcept = 0;
+
+            /**
+             * @brief Gets the position of an entity's component in the packed storage.
+             * @param index The entity index. Must be contained in this storage.
+             * @return The position of the component.
+             */
+            virtual u64 getPosition(u64 index) const noexcept = 0;
+
+            /**
+             * @brief Retrieves the entity index of every component, in packed order.
+             * @return A span over the entity indices.
+             */
+            virtual std::span<const u64> getIndices() const noexcept = 0;
+
+            /**
+             * @brief Swaps the packed positions of two entities' components.
+             * @param index1 The index of the first entity.
+             * @param index2 The index of the second entity.
+             */
+            virtual void swap(u64 index1, u64 index2) = 0;
+
+            /**
+             * @brief Removes an entity's component, if it has one.
+             * @param index The entity index.
+             */
+            virtual void erase(u64 index) = 0;
+        };
+
+        /**
+         * @brief When a component was last added and changed, in ticks of the registry's clock.
+         */
+        struct Ticks {
+            u64 added;    ///< The tick the component was added at.
+            u64 changed;  ///< The tick the component was last marked changed at. Adding counts as a change.
         };
 
         /**
@@ -24,7 +65,13 @@ namespace rome::core {
         template <Component T>
         class RM_API Pool final : public Storage {
             public:
-            Pool() : type(Reflect::reflect<T>().getType()) {}
+            /**
+             * @brief Creates a pool.
+             * @param resource The resource to allocate the components from, e.g. a SlabPool (default is the global heap).
+             * @param clock The clock stamping added components, or null to stamp them at tick 0.
+             */
+            explicit Pool(std::pmr::memory_resource* resource = std::pmr::get_default_resource(), const std::atomic<u64>* clock = nullptr)
+                : entities(resource), ticks(resource), clock(clock), type(Reflect::reflect<T>().getType()) {}
             ~Pool() = default;
             Pool(const Pool& other) = delete;
             Pool(Pool&& other) noexcept = default;
@@ -51,6 +98,30 @@ namespace rome::core {
                 return entities[entity.getIndex()];
             }
 
+            /**
+             * @brief Checks whether the entity at the given index has this component.
+             * @param index The entity index to check.
+             * @return True if the entity has this component, false otherwise.
+             */
+            b8 contains(u64 index) const noexcept override { return entities.contains(index); }
+
+            /**
+             * @brief Gets the position of an entity's component in the packed data.
+             * @param index The entity index. Must have this component.
+             * @return The position of the component in getData().
+             */
+            u64 getPosition(u64 index) const noexcept override { return entities.getPosition(index); }
+
+            /**
+             * @brief Gets the component for the entity at the given index.
+             * @param index The index of the entity to get the component for.
+             * @return The component for the entity.
+             */
+            T& at(u64 index) {
+                RM_ASSERT_MSG(entities.contains(index), "Entity does not have component T");
+                return entities[index];
+            }
+
             /**
              * @brief Inserts the component for the given entity.
              * @param entity The entity to insert the component for.
@@ -62,6 +133,7 @@ namespace rome::core {
                     return;
                 }
                 entities.emplace(entity.getIndex(), component);
+                stamp();
             }
 
             /**
@@ -76,6 +148,7 @@ namespace rome::core {
                     return;
                 }
                 entities.emplace(entity.getIndex(), T(std::forward<Args>(args)...));
+                stamp();
             }
 
             /**
@@ -87,15 +160,74 @@ namespace rome::core {
                     RM_WARN("Entity does not have component of type: %s", getType().getName().c_str());
                     return;
                 }
-                entities.erase(entity.getIndex());
+                erase(entity.getIndex());
+            }
+
+            /**
+             * @brief Marks an entity's component changed, for views filtering on Changed<T>.
+             * @param index The entity index. Must have this component.
+             * @param tick The tick of the change, usually the running system's tick.
+             */
+            void markChanged(u64 index, u64 tick) noexcept {
+                RM_ASSERT_MSG(entities.contains(index), "Entity does not have component T");
+                ticks[entities.getPosition(index)].changed = tick;
+            }
+
+            /**
+             * @brief Gets when an entity's component was added and last changed.
+             * @param index The entity index. Must have this component.
+             * @return The ticks of the component.
+             */
+            const Ticks& getTicks(u64 index) const noexcept {
+                RM_ASSERT_MSG(entities.contains(index), "Entity does not have component T");
+                return ticks[entities.getPosition(index)];
             }
 
+            /**
+             * @brief Retrieves the ticks of every component, in the same order as getData().
+             * @return A pointer to the first component's ticks.
+             */
+            Ticks* getTicks() noexcept { return ticks.data(); }
+
             /**
              * @brief Retrieves a contiguous data pointer and the size of the pool.
              * @return A pair containing a pointer to the start of the block and the size of the pool.
              */
             std::pair<T*, u64> getData() { return entities.getData(); }
 
+            /**
+             * @brief Retrieves the entity index of every component, in the same order as getData().
+             * @return A span over the entity indices.
+             */
+            std::span<const u64> getIndices() const noexcept override { return entities.getIndices(); }
+
+            /**
+             * @brief Swaps the packed positions of two entities' components.
+             * @param index1 The index of the first entity.
+             * @param index2 The index of the second entity.
+             */
+            void swap(u64 index1, u64 index2) override {
+                if (index1 == index2 || !entities.contains(index1) || !entities.contains(index2)) {
+                    return;
+                }
+                std::swap(ticks[entities.getPosition(index1)], ticks[entities.getPosition(index2)]);
+                entities.swap(index1, index2);
+            }
+
+            /**
+             * @brief Removes an entity's component, if it has one.
+             * @param index The entity index.
+             */
+            void erase(u64 index) override {
+                if (!entities.contains(index)) {
+                    return;
+                }
+                // Mirror the sparse set, which moves the last component into the hole
+                ticks[entities.getPosition(index)] = ticks.back();
+                ticks.pop_back();
+                entities.erase(index);
+            }
+
             /**
              * @brief Gets the reflected type for this pool's component type.
              * @return The reflected type for this pool's component type.
@@ -105,15 +237,31 @@ namespace rome::core {
                 return type;
             }
 
-            inline std::vector<T>::iterator begin() { return entities.begin(); }
-            inline std::vector<T>::iterator end() { return entities.end(); }
+            /**
+             * @brief Gets the resource the components are allocated from.
+             * @return The memory resource.
+             */
+            std::pmr::memory_resource* getResource() const noexcept { return entities.getResource(); }
+
+            inline std::pmr::vector<T>::iterator begin() { return entities.begin(); }
+            inline std::pmr::vector<T>::iterator end() { return entities.end(); }
 
-            inline std::vector<T>::const_iterator begin() const { return entities.begin(); }
-            inline std::vector<T>::const_iterator end() const { return entities.end(); }
+            inline std::pmr::vector<T>::const_iterator begin() const { return entities.begin(); }
+            inline std::pmr::vector<T>::const_iterator end() const { return entities.end(); }
 
             private:
-            SparseSet<T> entities;  ///< The entities with this component.
-            Type& type;             ///< The reflected type for this component.
+            SparseSet<T> entities;          ///< The entities with this component.
+            std::pmr::vector<Ticks> ticks;  ///< The ticks of every component, in the same order as the components.
+            const std::atomic<u64>* clock;  ///< The clock stamping added components, null for none.
+            Type& type;                     ///< The reflected type for this component.
+
+            /**
+             * @brief Stamps the component that was just added with the current tick.
+             */
+            void stamp() {
+                const u64 tick = clock ? clock->load(std::memory_order_relaxed) : 0;
+                ticks.push_back(Ticks{tick, tick});
+            }
         };
     }  // namespace Component
 }  // namespace rome::core
\ No newline at end of file
@@ -2,15 +2,75 @@
 
 namespace rome::core {
     namespace Component {
+        std::atomic<u32> Registry::nextType{0};
+
         u32 Registry::getCount() const { return store.size(); }
 
         const std::string& Registry::getName(ID id) const {
-            auto it = names.find(id);
-            if (it != names.end()) {
-                return it->second;
+            if (id < names.size()) {
+                return names[id];
             }
             std::string msg = "Component ID " + std::to_string(id) + " not found";
             THROW_CORE_EXCEPTION(Exception::Type::NotFound, msg.c_str());
         }
+
+        void Registry::destroy(const Entity& entity) {
+            const u64 index = entity.getIndex();
+            if (index >= signatures.size()) {
+                return;
+            }
+            signatures[index].each([&](ID id) {
+                for (const Unique<Ownership>& ownership : ownerships) {
+                    if (ownership->isTracking(id)) ownership->leave(index);
+                }
+                store.at(id)->erase(index);
+            });
+            signatures[index].clear();
+        }
+
+        Ownership& Registry::own(const std::vector<ID>& owned, const std::vector<ID>& observed) {
+            for (const Unique<Ownership>& ownership : ownerships) {
+                if (ownership->getOwned() == owned && ownership->getObserved() == observed) {
+                    ownership->holders++;
+                    return *ownership;
+                }
+                for (ID id : owned) {
+                    if (std::ranges::find(ownership->getOwned(), id) != ownership->getOwned().end()) {
+                        std::string msg = "Component '" + getName(id) + "' is already owned by another group";
+                        THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.c_str());
+                    }
+                }
+            }
+
+            auto storages = [this](const std::vector<ID>& ids) {
+                std::vector<Storage*> result;
+                for (ID id : ids) {
+                    result.push_back(store.at(id).get());
+                }
+                return result;
+            };
+            ownerships.push_back(MakeUnique<Ownership>(owned, storages(owned), observed, storages(observed), signatures));
+            ownerships.back()->holders = 1;
+            return *ownerships.back();
+        }
+
+        void Registry::disown(Ownership& ownership) {
+            RM_ASSERT_MSG(ownership.holders > 0, "Ownership released more times than it was obtained");
+            if (--ownership.holders == 0) {
+                std::erase_if(ownerships, [&](const Unique<Ownership>& held) { return held.get() == &ownership; });
+            }
+        }
+
+        b8 Registry::isOwnable(const std::vector<ID>& owned, const std::vector<ID>& observed) const noexcept {
+            for (const Unique<Ownership>& ownership : ownerships) {
+                if (ownership->getOwned() == owned && ownership->getObserved() == observed) {
+                    return true;
+                }
+                for (ID id : owned) {
+                    if (std::ranges::find(ownership->getOwned(), id) != ownership->getOwned().end()) return false;
+                }
+            }
+            return true;
+        }
     }  // namespace Component
 }  // namespace rome::core
\ No newline at end of file
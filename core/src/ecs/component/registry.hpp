@@ -2,12 +2,15 @@
 
 #include <shared_mutex>
 
-#include "ecs/component/pool.hpp"
+#include "ecs/component/ownership.hpp"
 
 namespace rome::core {
     namespace Component {
         /**
          * @brief Manages the registration, creation, and destruction of components.
+         * Component IDs are dense and given in registration order. Every component type also gets a process-wide index the
+         * first time it is used, under which the registry caches its ID and pool, so lookups after the first one are
+         * lock-free.
          * @note This registry is not thread-safe outside component registration.
          * @warning Every component must implement reflection and a copy-constructor to be registered.
          */
@@ -42,7 +45,9 @@ namespace rome::core {
             template <Component T>
             T& create(const Entity& entity, T& component) {
                 Pool<T>* pool = getPool<T>();
+                advance();
                 pool->insert(entity, component);
+                entered(getID<T>(), entity.getIndex());
                 return pool->get(entity);
             }
 
@@ -58,7 +63,9 @@ namespace rome::core {
             template <Component T, typename... Args>
             T& create(const Entity& entity, Args&&... args) {
                 Pool<T>* pool = getPool<T>();
+                advance();
                 pool->emplace(entity, std::forward<Args>(args)...);
+                entered(getID<T>(), entity.getIndex());
                 return pool->get(entity);
             }
 
@@ -70,9 +77,86 @@ namespace rome::core {
              */
             template <Component T>
             void remove(const Entity& entity) {
+                const ID id = getID<T>();
+                for (const Unique<Ownership>& ownership : ownerships) {
+                    if (ownership->isTracking(id)) ownership->leave(entity.getIndex());
+                }
+                if (entity.getIndex() < signatures.size()) {
+                    signatures[entity.getIndex()].reset(id);
+                }
                 getPool<T>()->remove(entity);
             }
 
+            /**
+             * @brief Marks an entity's component changed, for views filtering on Changed<T>.
+             * Views mark the components they hand out mutably on their own; use this after writing through get().
+             * @tparam T The component type.
+             * @param entity The entity whose component changed. Must have the component.
+             * @warning This function is not thread-safe.
+             */
+            template <Component T>
+            void markChanged(const Entity& entity) {
+                getPool<T>()->markChanged(entity.getIndex(), advance());
+            }
+
+            /**
+             * @brief Advances the change detection clock.
+             * The scheduler advances it before every system run; structural changes advance it too, so they are seen as
+             * newer than any system that already ran.
+             * @return The new tick.
+             * @note This function is thread-safe.
+             */
+            u64 advance() noexcept { return clock.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+            /**
+             * @brief Gets the current tick of the change detection clock.
+             * @return The current tick.
+             * @note This function is thread-safe.
+             */
+            u64 getTick() const noexcept { return clock.load(std::memory_order_relaxed); }
+
+            /**
+             * @brief Removes every component of the given entity, touching only the pools it has a component in.
+             * @param entity The entity to strip.
+             * @note Call this when destroying an entity, as Entity::Registry::destroy only recycles the ID.
+             * @warning This function is not thread-safe.
+             */
+            void destroy(const Entity& entity);
+
+            /**
+             * @brief Checks whether the given entity has every given component.
+             * @tparam Ts The component types to check.
+             * @param entity The entity to check.
+             * @return True if the entity has all the components, false otherwise.
+             * @warning This function is not thread-safe.
+             */
+            template <Component... Ts>
+            b8 has(const Entity& entity) {
+                return getSignature(entity.getIndex()).includes(getMask<Ts...>());
+            }
+
+            /**
+             * @brief Builds the signature made of the given components, to match entities against with getSignature().
+             * @tparam Ts The component types in the mask.
+             * @return The mask.
+             * @note This function is thread-safe.
+             */
+            template <Component... Ts>
+            Signature getMask() {
+                return Signature{getID<Ts>()...};
+            }
+
+            /**
+             * @brief Gets the components an entity has.
+             * @param index The entity index.
+             * @return The signature of the entity, empty if it never had a component.
+             * @warning This function is not thread-safe.
+             */
+            const Signature& getSignature(u64 index) const noexcept {
+                static const Signature empty;
+                return index < signatures.size() ? signatures[index] : empty;
+            }
+
             /**
              * @brief Gets the component for the given entity.
              * @tparam T The component type to get.
@@ -113,52 +197,153 @@ namespace rome::core {
             const std::string& getName(ID id) const;
 
             /**
-             * @brief Fetches the concrete pool for the given component type.
+             * @brief Packs the pools of the given components so that entities owning all of them share a common prefix.
+             * @param owned The IDs of the components whose pools are packed.
+             * @param observed The IDs of components also required for membership, but not packed.
+             * @return The ownership over the given components. Identical requests share the same ownership.
+             * @throws Exception::Type::InvalidArgument if a component is already owned by a different ownership.
+             * @note Every call must be matched by a call to disown() once the ownership is no longer needed.
+             * @warning This function is not thread-safe.
+             */
+            Ownership& own(const std::vector<ID>& owned, const std::vector<ID>& observed);
+
+            /**
+             * @brief Releases an ownership obtained from own(), destroying it once every holder released it.
+             * Its pools can then be owned again, and structural changes stop keeping its entities packed.
+             * @param ownership The ownership to release.
+             * @warning This function is not thread-safe.
+             */
+            void disown(Ownership& ownership);
+
+            /**
+             * @brief Checks whether the given components can be packed without stealing a pool from another ownership.
+             * @param owned The IDs of the components to pack.
+             * @param observed The IDs of components also required for membership, but not packed.
+             * @return True if own() would succeed with the same arguments, false otherwise.
+             * @warning This function is not thread-safe.
+             */
+            b8 isOwnable(const std::vector<ID>& owned, const std::vector<ID>& observed) const noexcept;
+
+            /**
+             * @brief Fetches the concrete pool for the given component type, registering the type on first use.
              * @tparam T The component type to fetch the pool for.
              * @return The pool for the given component type.
-             * @note This function is thread-safe.
+             * @note This function is thread-safe, and lock-free once the type is registered.
              */
             template <Component T>
             Pool<T>* getPool() {
-                ID id = getID<T>();
-                std::shared_lock readLock(idsLock);
-                auto it = store.find(id);
-                return static_cast<Pool<T>*>(it != store.end() ? it->second.get() : nullptr);
+                const u32 type = getTypeIndex<T>();
+                if (type < MaxTypes) {
+                    if (Storage* pool = slots[type].pool.load(std::memory_order_acquire)) {
+                        return static_cast<Pool<T>*>(pool);
+                    }
+                }
+                return static_cast<Pool<T>*>(enroll<T>(type).second);
             }
 
+            /**
+             * @brief Sets the resource that pools created from now on allocate their components from.
+             * @param resource The memory resource, e.g. a SlabPool. Must outlive the registry.
+             * @warning Pools of components already used keep their resource, so call this before anything else.
+             */
+            void setResource(std::pmr::memory_resource* resource) noexcept { this->resource = resource; }
+
+            /**
+             * @brief Gets the resource that new pools allocate their components from.
+             * @return The memory resource.
+             */
+            std::pmr::memory_resource* getResource() const noexcept { return resource; }
+
             private:
+            static constexpr u32 MaxTypes = 1024;  ///< The component types whose lookup is cached, later ones take the lock.
+
+            /**
+             * @brief The cached lookup of a component type.
+             */
+            struct Slot {
+                std::atomic<Storage*> pool{nullptr};  ///< The pool of the type, published once id is set.
+                ID id = 0;                            ///< The ID of the type.
+            };
+
+            static std::atomic<u32> nextType;                                             ///< The index of the next component type.
             mutable std::shared_mutex idsLock;                                            ///< Ensure thread-safe access to the IDs map.
-            std::unordered_map<ID, Unique<Storage>> store;                                ///< Storage for component pools.
-            std::unordered_map<ID, std::string> names;                                    ///< Maps component IDs to their names.
+            std::vector<Unique<Storage>> store;                                           ///< Storage for component pools, by ID.
+            std::vector<std::string> names;                                               ///< The component names, by ID.
             std::unordered_map<std::string, ID, TransparentSVHash, std::equal_to<>> ids;  ///< Maps component names to their IDs.
-            std::atomic_uint32_t nextId{0};                                               ///< The next available ID for a component.
+            Unique<Slot[]> slots = std::make_unique<Slot[]>(MaxTypes);                    ///< The cached lookups, by type index.
+            std::vector<Unique<Ownership>> ownerships;                                    ///< Packings kept up to date on create / remove.
+            std::pmr::memory_resource* resource = std::pmr::get_default_resource();       ///< The resource new pools allocate from.
+            std::vector<Signature> signatures;                                            ///< The components of every entity, by index.
+            std::atomic<u64> clock{0};                                                    ///< The change detection clock.
 
             /**
-             * @brief Gets the component ID for the given component type.
+             * @brief Records that an entity just received a component and notifies the ownerships tracking it.
+             * @param id The ID of the created component.
+             * @param index The index of the entity.
+             */
+            void entered(ID id, u64 index) {
+                if (index >= signatures.size()) {
+                    signatures.resize(index + 1);
+                }
+                signatures[index].set(id);
+                for (const Unique<Ownership>& ownership : ownerships) {
+                    if (ownership->isTracking(id)) ownership->enter(index, signatures[index]);
+                }
+            }
+
+            /**
+             * @brief Gets the component ID for the given component type, registering the type on first use.
              * @tparam T The component type to get the ID for.
              * @return The ID of the component type.
-             * @note This function is thread-safe.
+             * @note This function is thread-safe, and lock-free once the type is registered.
              */
             template <Component T>
             ID getID() {
-                static const std::string_view name = Reflect::reflect<T>().getType().getName();
-
-                {
-                    std::shared_lock read(idsLock);
-                    auto it = ids.find(name);
-                    if (it != ids.end()) return it->second;
+                const u32 type = getTypeIndex<T>();
+                if (type < MaxTypes) {
+                    const Slot& slot = slots[type];
+                    if (slot.pool.load(std::memory_order_acquire)) {
+                        return slot.id;
+                    }
                 }
+                return enroll<T>(type).first;
+            }
+
+            /**
+             * @brief Gets the process-wide index of a component type, shared by every registry.
+             * @tparam T The component type.
+             * @return The index of the type, given on first use.
+             */
+            template <Component T>
+            static u32 getTypeIndex() noexcept {
+                static const u32 type = nextType.fetch_add(1, std::memory_order_relaxed);
+                return type;
+            }
+
+            /**
+             * @brief Looks a component type up by name, registering it if needed, and caches the result.
+             * Types are keyed by their reflected name, so distinct types sharing a name share a pool.
+             * @tparam T The component type.
+             * @param type The index of the type.
+             * @return The ID and the pool of the type.
+             */
+            template <Component T>
+            std::pair<ID, Storage*> enroll(u32 type) {
+                static const std::string_view name = Reflect::reflect<T>().getType().getName();
 
                 std::unique_lock write(idsLock);
-                auto [it, inserted] = ids.emplace(name, nextId.load());
+                auto [it, inserted] = ids.emplace(name, static_cast<ID>(store.size()));
                 if (inserted) {
-                    ID id = nextId.fetch_add(1);
-                    it->second = id;
-                    names.emplace(id, std::string(name));
-                    store.emplace(id, std::make_unique<Pool<T>>());
-                    return id;
+                    names.emplace_back(name);
+                    store.push_back(std::make_unique<Pool<T>>(resource, &clock));
+                }
+                Storage* pool = store[it->second].get();
+                // Once published the slot is only ever read, so concurrent first uses must not write it again
+                if (type < MaxTypes && !slots[type].pool.load(std::memory_order_relaxed)) {
+                    slots[type].id = it->second;
+                    slots[type].pool.store(pool, std::memory_order_release);
                 }
-                return it->second;
+                return {it->second, pool};
             }
         };
     }  // namespace Component
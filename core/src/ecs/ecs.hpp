@@ -1,6 +1,10 @@
 #pragma once
 
+#include "ecs/command/buffer.hpp"
+#include "ecs/event/bus.hpp"
+#include "ecs/system/descriptor.hpp"
 #include "ecs/system/registry.hpp"
+#include "ecs/system/scheduler.hpp"
 
 namespace rome::core {
     /**
@@ -8,12 +12,32 @@ namespace rome::core {
      */
     class RM_API ECS {
         public:
-        ECS() = default;
+        /**
+         * @brief Where component data is stored.
+         * @note On the archetype backend, System::View walks the chunks of the matching archetypes. Archetypes keep no
+         *       component ticks, so views cannot filter on Added or Changed there.
+         */
+        enum class Backend : u8 {
+            SparseSet,  ///< One sparse-set pool per component type. Fast structural changes.
+            Archetype   ///< Entities grouped by component signature in chunked columns. Fast multi-component queries.
+        };
+
+        /**
+         * @brief Creates an ECS.
+         * @param backend The component storage backend to use for this instance.
+         */
+        explicit ECS(Backend backend = Backend::SparseSet)
+            : archetypes(components),
+              commands(backend == Backend::Archetype),
+              bus(world),
+              world{systems, components, archetypes, entities, events, bus, commands, backend == Backend::Archetype},
+              scheduler(world),
+              backend(backend) {}
         ~ECS() = default;
         ECS(const ECS&) = delete;
         ECS& operator=(const ECS&) = delete;
-        ECS(ECS&&) = default;
-        ECS& operator=(ECS&&) = default;
+        ECS(ECS&&) = delete;
+        ECS& operator=(ECS&&) = delete;
 
         /**
          * @brief Registers a new component type with the ECS.
@@ -23,7 +47,52 @@ namespace rome::core {
          */
         template <typename T>
         Component::ID registerComponent() {
-            return components.registerComponent<T>();
+            return components.enter<T>();
+        }
+
+        /**
+         * @brief Registers a new system with the ECS.
+         * @param descriptor The descriptor of the system, usually made by a System::Builder over getWorld().
+         * @return The ID of the registered system.
+         * @throws Exception::Type::InvalidArgument if a system with the same name already exists.
+         */
+        System::ID registerSystem(System::Descriptor&& descriptor) { return systems.enter(std::move(descriptor)); }
+
+        /**
+         * @brief Runs every active system once, in parallel wherever their accesses do not conflict.
+         * @note Deferred commands are played back before the first stage and after every stage.
+         */
+        void update() { scheduler.run(); }
+
+        /**
+         * @brief Gets the current thread's command buffer, to defer structural changes until the next sync point.
+         * @return The command buffer.
+         */
+        Command::Buffer& getCommands() { return commands.local(); }
+
+        /**
+         * @brief Plays back every deferred command now.
+         * @warning No system may be running.
+         */
+        void flush() { commands.playback(world); }
+
+        /**
+         * @brief Creates a new entity.
+         * @return The new entity.
+         */
+        Entity createEntity() { return entities.create(); }
+
+        /**
+         * @brief Destroys an entity along with all its components.
+         * @param entity The entity to destroy.
+         */
+        void destroyEntity(const Entity& entity) {
+            if (backend == Backend::Archetype) {
+                archetypes.destroy(entity);
+            } else {
+                components.destroy(entity);
+            }
+            entities.destroy(entity);
         }
 
         /**
@@ -34,7 +103,10 @@ namespace rome::core {
          */
         template <typename T>
         T& addComponent(const Entity& entity) {
-            return components.createComponent<T>(entity);
+            if (backend == Backend::Archetype) {
+                return archetypes.create<T>(entity);
+            }
+            return components.create<T>(entity);
         }
 
         /**
@@ -47,7 +119,10 @@ namespace rome::core {
          */
         template <typename T, typename... Args>
         T& addComponent(const Entity& entity, Args&&... args) {
-            return components.createComponent<T>(entity, std::forward<Args>(args)...);
+            if (backend == Backend::Archetype) {
+                return archetypes.create<T>(entity, std::forward<Args>(args)...);
+            }
+            return components.create<T>(entity, std::forward<Args>(args)...);
         }
 
         /**
@@ -57,7 +132,25 @@ namespace rome::core {
          */
         template <typename T>
         void removeComponent(const Entity& entity) {
-            components.removeComponent<T>(entity);
+            if (backend == Backend::Archetype) {
+                archetypes.remove<T>(entity);
+                return;
+            }
+            components.remove<T>(entity);
+        }
+
+        /**
+         * @brief Checks whether the given entity has every given component.
+         * @tparam Ts The component types to check.
+         * @param entity The entity to check.
+         * @return True if the entity has all the components, false otherwise.
+         */
+        template <typename... Ts>
+        b8 hasComponents(const Entity& entity) {
+            if (backend == Backend::Archetype) {
+                return (archetypes.has<Ts>(entity) && ...);
+            }
+            return components.has<Ts...>(entity);
         }
 
         /**
@@ -68,7 +161,10 @@ namespace rome::core {
          */
         template <typename T>
         T& getComponent(const Entity& entity) {
-            return components.getComponent<T>(entity);
+            if (backend == Backend::Archetype) {
+                return archetypes.get<T>(entity);
+            }
+            return components.get<T>(entity);
         }
 
         /**
@@ -79,20 +175,81 @@ namespace rome::core {
          */
         template <typename T>
         const T& getComponent(const Entity& entity) const {
-            return components.getComponent<T>(entity);
+            // Lookups may lazily register the component type, hence the const_cast
+            return const_cast<ECS*>(this)->getComponent<T>(entity);
         }
 
+        /**
+         * @brief Calls a function for every entity owning all the given components.
+         * @tparam Ts The component types to fetch. Const-qualify read-only components.
+         * @tparam Function The type of the function, invocable with (Ts&...).
+         * @param function The function to call.
+         * @note On the archetype backend this walks matching chunks linearly; on the sparse-set backend it walks
+         *       the first component's pool and probes the others.
+         */
+        template <Component::Component... Ts, typename Function>
+        void each(Function&& function) {
+            if (backend == Backend::Archetype) {
+                archetypes.each<Ts...>(function);
+                return;
+            }
+            probe(function, components.getPool<remove_all_qualifiers_t<Ts>>()...);
+        }
+
+        /**
+         * @brief Gets the component storage backend of this instance.
+         * @return The backend.
+         */
+        Backend getBackend() const { return backend; }
+
         /**
          * @brief Gets the current state of the ECS.
          * @return The current state of the ECS.
          */
         World& getWorld() { return world; }
 
+        /**
+         * @brief Gets the system scheduler, e.g. to inspect its stage layout.
+         * @return The system scheduler.
+         */
+        System::Scheduler& getScheduler() { return scheduler; }
+
+        /**
+         * @brief Gets the event bus.
+         * @return The event bus.
+         */
+        Event::Bus& getBus() { return bus; }
+
         private:
-        System::Registry systems;        ///< The registry for all systems in the ECS.
-        Component::Registry components;  ///< The registry for all components in the ECS.
-        Entity::Registry entities;       ///< The registry for all entities in the ECS.
-        Event::Registry events;          ///< The registry for all events in the ECS.
-        World world;                     ///< A reference to the ECS state.
+        Component::Registry components;    ///< The registry for all components in the ECS.
+        System::Registry systems;          ///< The registry for all systems in the ECS, destroyed before the ownerships its groups hold.
+        Component::Archetypes archetypes;  ///< The archetype storage for all components in the ECS.
+        Entity::Registry entities;         ///< The registry for all entities in the ECS.
+        Event::Registry events;            ///< The registry for all events in the ECS.
+        Command::Queue commands;           ///< The structural changes deferred by systems.
+        Event::Bus bus;                    ///< The event queues of every event type.
+        World world;                       ///< A reference to the ECS state.
+        System::Scheduler scheduler;       ///< Runs the registered systems in parallel stages.
+        const Backend backend;             ///< The component storage backend.
+
+        /**
+         * @brief Walks the lead pool and calls a function for every entity also present in the other pools.
+         * @tparam Function The type of the function.
+         * @tparam Lead The component type driving the iteration.
+         * @tparam Rest The other component types.
+         * @param function The function to call.
+         * @param lead The pool driving the iteration.
+         * @param rest The other pools.
+         */
+        template <typename Function, typename Lead, typename... Rest>
+        static void probe(Function& function, Component::Pool<Lead>* lead, Component::Pool<Rest>*... rest) {
+            auto [data, size] = lead->getData();
+            const std::span<const u64> indices = lead->getIndices();
+            for (u64 i = 0; i < size; i++) {
+                if ((rest->contains(indices[i]) && ...)) {
+                    function(data[i], rest->at(indices[i])...);
+                }
+            }
+        }
     };
 }  // namespace rome::core
\ No newline at end of file
@@ -23,5 +23,10 @@ namespace rome::core {
         available++;
     }
 
+    Entity Entity::Registry::get(u64 index) const {
+        RM_ASSERT_MSG(index < entities.size() && getIndex(entities[index]) == index, "No live entity at index");
+        return Entity(entities[index]);
+    }
+
     b8 Entity::Registry::isAlive(Entity entity) const { return getVersion(entities[getIndex(entity.id)]) == getVersion(entity.id); }
 }  // namespace rome::core
\ No newline at end of file
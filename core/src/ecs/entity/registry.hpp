@@ -24,6 +24,7 @@ namespace rome::core {
         /**
          * @brief Destroys an entity.
          * @param entity The entity to destroy.
+         * @note Only recycles the ID. Its components are left in place, use ECS::destroyEntity to remove them too.
          * @warning This function is not thread-safe.
          */
         void destroy(Entity entity);
@@ -36,6 +37,14 @@ namespace rome::core {
          */
         b8 isAlive(Entity entity) const;
 
+        /**
+         * @brief Gets the entity currently occupying an index, e.g. one taken from a pool's indices.
+         * @param index The entity index. Must belong to a live entity.
+         * @return The entity, with its current version.
+         * @warning This function is not thread-safe.
+         */
+        Entity get(u64 index) const;
+
         private:
         std::vector<u64> entities;  ///< The entity pool.
         u64 next = 0;               ///< The next available entity index.
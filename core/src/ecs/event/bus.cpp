@@ -2,10 +2,35 @@
 
 namespace rome::core {
     namespace Event {
+        std::atomic<u64> Queue::nextSerial{0};
+        thread_local u64 Queue::key = 0;
+        thread_local u64 Queue::position = 0;
+
+        void Queue::setKey(u64 key, u64 position) noexcept {
+            Queue::key = key;
+            Queue::position = position;
+        }
+
+        u64 Queue::getKey() noexcept { return key; }
+
+        u64 Queue::getPosition() noexcept { return position; }
+
         void Bus::swap() {
-            for (auto& [_, q] : queues) {
-                q->swap();
+            pending.clear();
+            for (ID id = 0; id < queues.size(); id++) {
+                if (!queues[id]) continue;
+                queues[id]->swap();
+                if (queues[id]->getCount() > 0) pending.set(id);
             }
         }
+
+        void Bus::listen(ID event, u32 system) {
+            if (event >= listeners.size()) {
+                listeners.resize(event + 1);
+            }
+            listeners[event].push_back(system);
+        }
+
+        void Bus::clearListeners() noexcept { listeners.clear(); }
     }  // namespace Event
 }  // namespace rome::core
\ No newline at end of file
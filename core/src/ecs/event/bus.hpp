@@ -1,5 +1,12 @@
 #pragma once
 
+#include <bit>
+#include <condition_variable>
+#include <functional>
+
+#include "container/bitset.hpp"
+#include "debug/metrics.hpp"
+#include "ecs/command/buffer.hpp"
 #include "ecs/world.hpp"
 
 namespace rome::core {
@@ -15,43 +22,212 @@ namespace rome::core {
              * @brief Swaps the front (read) and back (write) buffers.
              */
             virtual void swap() = 0;
+
+            /**
+             * @brief Gets the number of events readers can see, those published by the last swap.
+             * @return The number of events in the front buffer.
+             */
+            virtual u64 getCount() const noexcept = 0;
+
+            /**
+             * @brief Makes the calling thread push under a key and position until the scope ends, then restores the previous ones.
+             * Threads waiting on jobs run other jobs meanwhile, so every job scopes its order rather than setting it.
+             */
+            class Scope final {
+                public:
+                Scope(u64 key, u64 position) noexcept : savedKey(Queue::key), savedPosition(Queue::position) { setKey(key, position); }
+                ~Scope() { setKey(savedKey, savedPosition); }
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+                Scope(Scope&&) = delete;
+                Scope& operator=(Scope&&) = delete;
+
+                private:
+                const u64 savedKey;       ///< The key the thread pushed under before.
+                const u64 savedPosition;  ///< The position the thread pushed under before.
+            };
+
+            /**
+             * @brief Sets the key ordering the events the calling thread pushes from now on, once merged by swap().
+             * @param key The key, lower keys are read first. The scheduler uses the ID of the running system.
+             * @param position The position among the events of the key, lower positions are read first. Views hand every
+             *                 batch of parallelEach the position of its command sub-task, see Command::Buffer::Task.
+             */
+            static void setKey(u64 key, u64 position = 0) noexcept;
+
+            /**
+             * @brief Gets the key ordering the events the calling thread pushes.
+             * @return The key.
+             */
+            static u64 getKey() noexcept;
+
+            /**
+             * @brief Gets the position ordering the events the calling thread pushes among those of its key.
+             * @return The position.
+             */
+            static u64 getPosition() noexcept;
+
+            protected:
+            static constexpr u64 MaxBound = 16;  ///< The most queues of a type a thread keeps a back buffer for.
+
+            static std::atomic<u64> nextSerial;  ///< The serial of the next queue.
+            static thread_local u64 key;         ///< The key of the events the current thread pushes.
+            static thread_local u64 position;    ///< The position of the events the current thread pushes, within the key.
+        };
+
+        /**
+         * @brief What a bounded event queue does with an event pushed while it is full.
+         */
+        enum class Overflow : u8 {
+            DropOldest,  ///< Overwrites the oldest event of the frame.
+            DropNewest,  ///< Discards the event being pushed.
+            Block,       ///< Waits for the next swap to make room. Pushing from a system throws, the swap runs between updates.
+            Spill        ///< Keeps the event in a heap buffer that is released once the event has been read.
+        };
+
+        /**
+         * @brief The bounds of an event queue holding at most a fixed number of events per frame.
+         */
+        struct Bounds {
+            u64 capacity;                            ///< The most events a frame can hold without overflowing.
+            Overflow policy = Overflow::DropOldest;  ///< What happens to the events past the capacity.
+        };
+
+        /**
+         * @brief How an event queue folds the events sharing a key into one, for events that only matter once per key per
+         * frame (e.g. an entity whose transform is dirty).
+         * @tparam E The event type.
+         */
+        template <Event E>
+        struct Coalescing {
+            std::function<u64(const E&)> key;              ///< Extracts the key of an event.
+            std::function<void(E&, E&&)> merge = nullptr;  ///< Folds a later event into the kept one, or null to keep the latest.
         };
 
         /**
          * @brief A storage for every event of this type.
+         * Every thread pushes into a back buffer of its own, so systems running in parallel can emit the same event type
+         * without sharing a cache line. swap() merges the back buffers into the front one, ordered by the key and position
+         * the events were pushed under, then by push order, so readers see the same order whichever thread ran which
+         * system, or which batch of a parallel view.
+         * A bounded storage instead pushes every event into a single fixed-capacity ring under a lock, keeping push order,
+         * and reuses the same two buffers every frame so a burst cannot grow them. Overflows are counted and reported to
+         * the Metrics of the thread calling swap().
+         * A coalescing storage then folds the events sharing a key into the first of them, through a flat hash table, so
+         * readers see every key once.
          * @tparam E The event type to store.
+         * @note Jobs a system submits itself must scope their order to keep it, see Queue::Scope, or their events carry
+         *       the key and position of whatever their thread last ran.
          */
         template <Event E>
         class RM_API Storage final : public Queue {
             public:
-            Storage() = default;
+            /**
+             * @brief Creates a queue.
+             * @param resource The resource to allocate the events from, e.g. a SlabPool (default is the global heap).
+             */
+            explicit Storage(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : front(resource), resource(resource), serial(nextSerial.fetch_add(1)) {}
+
+            /**
+             * @brief Creates a bounded queue.
+             * @param bounds The capacity of the queue and its overflow policy.
+             * @param resource The resource to allocate the events from, e.g. a SlabPool (default is the global heap).
+             * @throws Exception::Type::InvalidArgument if the capacity is 0.
+             */
+            explicit Storage(Bounds bounds, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : Storage(resource) {
+                if (bounds.capacity == 0) {
+                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "Bounded event queues need a capacity");
+                }
+                ring = MakeUnique<Ring>(bounds, resource);
+                front.reserve(bounds.capacity);
+            }
+
+            /**
+             * @brief Creates a coalescing queue.
+             * @param coalescing The key extractor and the optional merge function.
+             * @param resource The resource to allocate the events from, e.g. a SlabPool (default is the global heap).
+             * @throws Exception::Type::InvalidArgument if the key extractor is empty.
+             */
+            explicit Storage(Coalescing<E> coalescing, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : Storage(resource) {
+                if (!coalescing.key) {
+                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "Coalescing event queues need a key extractor");
+                }
+                this->coalescing = std::move(coalescing);
+            }
             ~Storage() = default;
             Storage(const Storage&) = delete;
             Storage& operator=(const Storage&) = delete;
-            Storage(Storage&&) = default;
-            Storage& operator=(Storage&&) = default;
+            Storage(Storage&&) = delete;
+            Storage& operator=(Storage&&) = delete;
 
             /**
              * @brief Adds an event to the queue.
              * @param event The event to queue.
+             * @throws Exception::Type::NotSupported if the queue blocks and the calling thread runs a system.
+             * @note This function is thread-safe, and lock-free once the thread has a back buffer.
              */
-            void push(const E& event) { back.push_back(event); }
+            void push(const E& event) {
+                if (ring) {
+                    offer(E(event));
+                    return;
+                }
+                Back& back = local();
+                back.mark();
+                back.events.push_back(event);
+            }
 
             /**
              * @brief Builds an event in-place in the queue.
              * @tparam ...Args The types of arguments to pass to the event constructor.
              * @param ...args The arguments to pass to the event constructor.
+             * @throws Exception::Type::NotSupported if the queue blocks and the calling thread runs a system.
+             * @note This function is thread-safe, and lock-free once the thread has a back buffer.
              */
             template <typename... Args>
             void emplace(Args&&... args) {
-                back.emplace_back(std::forward<Args>(args)...);
+                if (ring) {
+                    offer(E(std::forward<Args>(args)...));
+                    return;
+                }
+                Back& back = local();
+                back.mark();
+                back.events.emplace_back(std::forward<Args>(args)...);
             }
 
             /**
              * @brief Checks whether the queue is empty.
              * @return True if the queue is empty, false otherwise.
+             * @warning No thread may be pushing meanwhile.
+             */
+            b8 empty() const {
+                if (ring) {
+                    std::lock_guard guard(ring->lock);
+                    return front.empty() && ring->events.empty() && ring->spill.empty();
+                }
+                std::lock_guard guard(backsLock);
+                return front.empty() && std::ranges::all_of(backs, [](const Unique<Back>& back) { return back->events.empty(); });
+            }
+
+            /**
+             * @brief Gets the number of events a bounded queue has dropped since it was created.
+             * @return The number of dropped events, always 0 for an unbounded queue.
+             */
+            u64 getDropped() const noexcept { return ring ? ring->dropped.load(std::memory_order_relaxed) : 0; }
+
+            /**
+             * @brief Gets the number of events a bounded queue has spilled past its capacity since it was created.
+             * @return The number of spilled events, always 0 for an unbounded queue.
+             */
+            u64 getSpilled() const noexcept { return ring ? ring->spilled.load(std::memory_order_relaxed) : 0; }
+
+            /**
+             * @brief Gets the number of events a coalescing queue has folded into others since it was created.
+             * @return The number of coalesced events, always 0 for a queue that does not coalesce.
              */
-            b8 empty() const { return front.empty() && back.empty(); }
+            u64 getCoalesced() const noexcept { return coalesced; }
 
             /**
              * @brief Returns a back-to-front view of the queue's front buffer.
@@ -60,38 +236,327 @@ namespace rome::core {
             std::span<const E> read() const { return std::span<const E>(front.data(), front.size()); }
 
             /**
-             * @brief Swaps the front (read) and back (write) buffers.
+             * @brief Gets the number of events readers can see, those published by the last swap.
+             * @return The number of events in the front buffer.
+             */
+            u64 getCount() const noexcept override { return front.size(); }
+
+            /**
+             * @brief Replaces the front (read) buffer with the events pushed since the last swap, coalescing them if needed.
+             * @warning No thread may be pushing or reading meanwhile.
              */
             void swap() override {
-                front.swap(back);
-                back.clear();
+                if (ring) {
+                    rotate();
+                } else {
+                    merge();
+                }
+                if (coalescing.key) {
+                    coalesce();
+                }
             }
 
             private:
-            std::vector<E> front;  ///< Consumers read from this vector.
-            std::vector<E> back;   ///< Producers write to this vector.
+            /**
+             * @brief A stretch of events pushed under the same key and position.
+             */
+            struct Run {
+                u64 key;       ///< The key the events were pushed under.
+                u64 position;  ///< The position the events were pushed under.
+                u64 begin;     ///< The index of the first event in the back buffer.
+            };
+
+            /**
+             * @brief The events a thread pushed since the last swap, on cache lines of its own.
+             */
+            struct alignas(64) Back {
+                std::pmr::vector<E> events;  ///< The events, in push order.
+                std::pmr::vector<Run> runs;  ///< Where the key or position changes along the events.
+
+                explicit Back(std::pmr::memory_resource* resource) : events(resource), runs(resource) {}
+
+                /**
+                 * @brief Starts a new run if the thread's key or position changed since the last push.
+                 */
+                void mark() {
+                    if (runs.empty() || runs.back().key != key || runs.back().position != position) {
+                        runs.push_back(Run{key, position, events.size()});
+                    }
+                }
+            };
+
+            /**
+             * @brief The fixed-capacity buffer of a bounded queue, shared by every producer.
+             */
+            struct Ring {
+                const Bounds bounds;            ///< The capacity and overflow policy.
+                mutable std::mutex lock;        ///< Guards the buffers.
+                std::condition_variable space;  ///< Wakes blocked producers once swap() made room.
+                std::pmr::vector<E> events;     ///< The events of the frame, reserved to the capacity.
+                std::pmr::vector<E> spill;      ///< The events past the capacity, with the Spill policy.
+                u64 head = 0;                   ///< The oldest event once DropOldest wrapped around.
+                u64 frameDropped = 0;           ///< The events dropped since the last swap.
+                std::atomic<u64> dropped{0};    ///< The events dropped since the queue was created.
+                std::atomic<u64> spilled{0};    ///< The events spilled since the queue was created.
+
+                Ring(Bounds bounds, std::pmr::memory_resource* resource) : bounds(bounds), events(resource), spill(resource) {
+                    events.reserve(bounds.capacity);
+                }
+            };
+
+            /**
+             * @brief The position of a run in the merge order.
+             */
+            struct Entry {
+                u64 key;       ///< The key of the run.
+                u64 position;  ///< The position of the run within its key.
+                u32 buffer;    ///< The back buffer holding the run.
+                u32 run;       ///< The index of the run in its back buffer.
+            };
+
+            /**
+             * @brief A slot of the coalescing hash table.
+             */
+            struct Slot {
+                u64 key;       ///< The key of the event kept for it.
+                u64 position;  ///< The position of the kept event in the front buffer, Empty if the slot is free.
+            };
+
+            static constexpr u64 Empty = std::numeric_limits<u64>::max();  ///< Marks a free slot of the hash table.
+
+            static inline thread_local std::vector<std::pair<u64, Back*>> bound;  ///< The current thread's buffers, by queue serial.
+            std::pmr::vector<E> front;                                            ///< Consumers read from this vector.
+            std::pmr::memory_resource* resource;                                  ///< The resource the back buffers allocate from.
+            const u64 serial;                                                     ///< Identifies the queue in the thread buffers.
+            mutable std::mutex backsLock;                                         ///< Guards the list of back buffers.
+            std::vector<Unique<Back>> backs;                                      ///< Every back buffer, in thread registration order.
+            std::vector<Entry> order;                                             ///< The merge order, kept to reuse its memory.
+            Unique<Ring> ring;                                                    ///< The buffer of a bounded queue, null if unbounded.
+            Coalescing<E> coalescing;                                             ///< How events are coalesced, no key if they are not.
+            std::vector<Slot> table;                                              ///< The coalescing hash table, kept to reuse its memory.
+            u64 coalesced = 0;                                                    ///< The events coalesced since the queue was created.
+
+            /**
+             * @brief Merges the back buffers into the front one, in key then position order.
+             */
+            void merge() {
+                std::lock_guard guard(backsLock);
+                order.clear();
+                Back* only = nullptr;
+                u64 total = 0;
+                for (u32 i = 0; i < backs.size(); i++) {
+                    const Back& back = *backs[i];
+                    for (u32 run = 0; run < back.runs.size(); run++) {
+                        order.push_back(Entry{back.runs[run].key, back.runs[run].position, i, run});
+                    }
+                    if (!back.events.empty()) {
+                        only = total == 0 ? backs[i].get() : nullptr;
+                        total += back.events.size();
+                    }
+                }
+
+                // A single thread pushing in order is the common case, and needs no copy
+                auto rank = [](const auto& run) { return std::pair(run.key, run.position); };
+                if (only && std::ranges::is_sorted(only->runs, {}, rank)) {
+                    front.swap(only->events);
+                } else {
+                    std::ranges::stable_sort(order, {}, rank);
+                    front.clear();
+                    front.reserve(total);
+                    for (const Entry& entry : order) {
+                        Back& back = *backs[entry.buffer];
+                        const u64 begin = back.runs[entry.run].begin;
+                        const u64 end = entry.run + 1 < back.runs.size() ? back.runs[entry.run + 1].begin : back.events.size();
+                        front.insert(front.end(), std::make_move_iterator(back.events.begin() + begin),
+                                     std::make_move_iterator(back.events.begin() + end));
+                    }
+                }
+                for (const Unique<Back>& back : backs) {
+                    back->events.clear();
+                    back->runs.clear();
+                }
+            }
+
+            /**
+             * @brief Pushes an event into the ring of a bounded queue, applying the overflow policy if it is full.
+             * @param event The event to push.
+             * @throws Exception::Type::NotSupported if the queue blocks and the calling thread runs a system, which would
+             *         wait for a swap that only happens once every system returned.
+             */
+            void offer(E&& event) {
+                if (ring->bounds.policy == Overflow::Block && Command::Buffer::isScoped()) {
+                    THROW_CORE_EXCEPTION(Exception::Type::NotSupported, "Systems cannot push into blocking event queues");
+                }
+                std::unique_lock guard(ring->lock);
+                const u64 capacity = ring->bounds.capacity;
+                if (ring->events.size() < capacity) {
+                    ring->events.push_back(std::move(event));
+                    return;
+                }
+                switch (ring->bounds.policy) {
+                    case Overflow::DropOldest:
+                        ring->events[ring->head] = std::move(event);
+                        ring->head = (ring->head + 1) % capacity;
+                        ring->frameDropped++;
+                        break;
+                    case Overflow::DropNewest:
+                        ring->frameDropped++;
+                        break;
+                    case Overflow::Block:
+                        ring->space.wait(guard, [&]() { return ring->events.size() < capacity; });
+                        ring->events.push_back(std::move(event));
+                        break;
+                    case Overflow::Spill:
+                        ring->spill.push_back(std::move(event));
+                        break;
+                }
+            }
+
+            /**
+             * @brief Publishes the ring of a bounded queue as the front buffer, oldest event first, and recycles the old front.
+             */
+            void rotate() {
+                u64 dropped = 0;
+                u64 spilled = 0;
+                {
+                    std::lock_guard guard(ring->lock);
+                    std::rotate(ring->events.begin(), ring->events.begin() + ring->head, ring->events.end());
+                    front.swap(ring->events);
+                    front.insert(front.end(), std::make_move_iterator(ring->spill.begin()), std::make_move_iterator(ring->spill.end()));
+                    ring->events.clear();
+                    // The old front outgrew the capacity if it took spilled events, so give that memory back
+                    if (ring->events.capacity() > ring->bounds.capacity) {
+                        ring->events = std::pmr::vector<E>(resource);
+                        ring->events.reserve(ring->bounds.capacity);
+                    }
+                    spilled = ring->spill.size();
+                    ring->spill = std::pmr::vector<E>(resource);
+                    dropped = ring->frameDropped;
+                    ring->frameDropped = 0;
+                    ring->head = 0;
+                }
+                ring->space.notify_all();
+
+                if (dropped > 0 || spilled > 0) {
+                    ring->dropped.fetch_add(dropped, std::memory_order_relaxed);
+                    ring->spilled.fetch_add(spilled, std::memory_order_relaxed);
+                    Metrics::getInstance().registerEventOverflow(dropped, spilled);
+                }
+            }
+
+            /**
+             * @brief Folds the front buffer events sharing a key into the first of them, keeping the order of the first
+             * occurrences. Keys go through an open-addressing table sized to twice the events, so probes stay short.
+             */
+            void coalesce() {
+                if (front.size() < 2) return;
+                const u64 size = std::bit_ceil(front.size() * 2);
+                const u64 shift = 64 - std::countr_zero(size);
+                table.assign(size, Slot{0, Empty});
+
+                u64 kept = 0;
+                for (u64 i = 0; i < front.size(); i++) {
+                    const u64 key = coalescing.key(front[i]);
+                    // Fibonacci hashing spreads the sequential keys entity indices tend to be
+                    u64 slot = (key * 0x9E3779B97F4A7C15ull) >> shift;
+                    while (table[slot].position != Empty && table[slot].key != key) {
+                        slot = (slot + 1) & (size - 1);
+                    }
+                    if (table[slot].position == Empty) {
+                        table[slot] = Slot{key, kept};
+                        if (kept != i) front[kept] = std::move(front[i]);
+                        kept++;
+                    } else if (coalescing.merge) {
+                        coalescing.merge(front[table[slot].position], std::move(front[i]));
+                    } else {
+                        front[table[slot].position] = std::move(front[i]);
+                    }
+                }
+                coalesced += front.size() - kept;
+                front.erase(front.begin() + kept, front.end());
+            }
+
+            /**
+             * @brief Gets the current thread's back buffer, creating it on first use.
+             * @return The current thread's back buffer.
+             */
+            Back& local() {
+                for (auto& [owner, back] : bound) {
+                    if (owner == serial) {
+                        return *back;
+                    }
+                }
+
+                Unique<Back> back = MakeUnique<Back>(resource);
+                Back* result = back.get();
+                {
+                    std::lock_guard guard(backsLock);
+                    backs.push_back(std::move(back));
+                }
+                // Serials are never reused, so entries of destroyed queues never match again
+                if (bound.size() >= MaxBound) {
+                    bound.erase(bound.begin());
+                }
+                bound.emplace_back(serial, result);
+                return *result;
+            }
         };
 
+        /**
+         * @brief Holds the event queue of every event type, in a vector indexed by event ID.
+         * Queues are also cached by the process-wide index of their type, so queue() is a single indexed load once the
+         * queue exists. The bus also indexes the systems listening to every event, so that the scheduler can wake only
+         * those with pending events.
+         */
         class RM_API Bus final {
             public:
-            Bus() = default;
+            /**
+             * @brief Creates a bus.
+             * @param world The world whose event registry gives the event IDs.
+             */
+            explicit Bus(World& world) : slots(std::make_unique<std::atomic<Queue*>[]>(Registry::MaxTypes)), world(world) {}
             ~Bus() = default;
+            Bus(const Bus&) = delete;
+            Bus& operator=(const Bus&) = delete;
+            Bus(Bus&&) = delete;
+            Bus& operator=(Bus&&) = delete;
 
             /**
              * @brief Enters a new event queue into the bus.
              * @tparam E The event type to enter.
+             * @return The ID of the event type.
              * @throws Exception::Type::InvalidArgument if the event queue already exists.
              * @note This function is thread-safe.
              */
             template <Event E>
-            void enter() {
-                std::unique_lock lock(queuesLock);
-                auto it = queues.find(world.events.get<E>());
-                if (it != queues.end()) {
-                    string msg = "Event queue for '" + Reflect::reflect<E>().name + "' already exists";
-                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.);
-                }
-                queues.emplace(world.events.get<E>(), MakeUnique<Storage<E>>());
+            ID enter() {
+                return install<E>(MakeUnique<Storage<E>>());
+            }
+
+            /**
+             * @brief Enters a new bounded event queue into the bus.
+             * @tparam E The event type to enter.
+             * @param bounds The capacity of the queue and its overflow policy.
+             * @return The ID of the event type.
+             * @throws Exception::Type::InvalidArgument if the event queue already exists or the capacity is 0.
+             * @note This function is thread-safe.
+             */
+            template <Event E>
+            ID enter(Bounds bounds) {
+                return install<E>(MakeUnique<Storage<E>>(bounds));
+            }
+
+            /**
+             * @brief Enters a new coalescing event queue into the bus, whose readers see every key once per frame.
+             * @tparam E The event type to enter.
+             * @param coalescing The key extractor and the optional merge function.
+             * @return The ID of the event type.
+             * @throws Exception::Type::InvalidArgument if the event queue already exists or the key extractor is empty.
+             * @note This function is thread-safe.
+             */
+            template <Event E>
+            ID enter(Coalescing<E> coalescing) {
+                return install<E>(MakeUnique<Storage<E>>(std::move(coalescing)));
             }
 
             /**
@@ -99,29 +564,103 @@ namespace rome::core {
              * @tparam E The event type to retrieve.
              * @return A reference to the event queue.
              * @throws Exception::Type::InvalidArgument if the event queue does not exist.
-             * @warning This function is not thread-safe.
+             * @note This function is thread-safe, and lock-free once the queue exists.
              */
             template <Event E>
             Storage<E>& queue() {
-                const ID id = world.events.get<E>();
+                const u32 type = Registry::getTypeIndex<E>();
+                if (type < Registry::MaxTypes) {
+                    if (Queue* queue = slots[type].load(std::memory_order_acquire)) {
+                        return *static_cast<Storage<E>*>(queue);
+                    }
+                }
 
-                auto it = queues.find(id);
-                if (it == queues.end()) {
-                    std::string msg = "Event queue for '" + Reflect::reflect<E>().name + "' does not exist";
-                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.c_str());
+                std::shared_lock lock(queuesLock);
+                const std::string& name = Reflect::reflect<E>().getType().getName();
+                if (world.events.contains(name)) {
+                    const ID id = world.events.get(name);
+                    if (id < queues.size() && queues[id]) return *static_cast<Storage<E>*>(queues[id].get());
                 }
-                return *static_cast<Storage<E>*>(it->second.get());
+                std::string msg = "Event queue for '" + name + "' does not exist";
+                THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.c_str());
             }
 
             /**
-             * @brief Swaps the front (read) and back (write) buffers for all event queues.
+             * @brief Swaps the front (read) and back (write) buffers for all event queues, and records which have events.
+             * @warning No thread may be pushing or reading meanwhile.
              */
             void swap();
 
+            /**
+             * @brief Records that a system listens to an event.
+             * @param event The event ID.
+             * @param system The system ID.
+             * @warning This function is not thread-safe.
+             */
+            void listen(ID event, u32 system);
+
+            /**
+             * @brief Forgets every listener, e.g. before the scheduler indexes the registered systems again.
+             * @warning This function is not thread-safe.
+             */
+            void clearListeners() noexcept;
+
+            /**
+             * @brief Calls a function for every system listening to an event that has events since the last swap.
+             * A system listening to several pending events is passed once per event.
+             * @tparam Function The type of the function, invocable with (u32).
+             * @param function The function to call with the system ID.
+             * @warning This function is not thread-safe.
+             */
+            template <typename Function>
+            void wake(Function&& function) const {
+                pending.each([&](ID event) {
+                    if (event >= listeners.size()) return;
+                    for (u32 system : listeners[event]) {
+                        function(system);
+                    }
+                });
+            }
+
+            /**
+             * @brief Gets the events that have events since the last swap.
+             * @return The IDs of the pending events.
+             */
+            inline const BitSet<ID>& getPending() const noexcept { return pending; }
+
             private:
-            std::shared_mutex queuesLock;                  ///< Mutex to protect the queues map.
-            std::unordered_map<ID, Unique<Queue>> queues;  ///< The queues for each event type.
-            World& world;                                  ///< The world feeding this bus.
+            std::shared_mutex queuesLock;             ///< Mutex to protect the queues.
+            std::vector<Unique<Queue>> queues;        ///< The queue of every event type, by ID.
+            std::vector<std::vector<u32>> listeners;  ///< The systems listening to every event, by ID.
+            BitSet<ID> pending;                       ///< The events with readable events since the last swap.
+            Unique<std::atomic<Queue*>[]> slots;      ///< The queues, by type index.
+            World& world;                             ///< The world feeding this bus.
+
+            /**
+             * @brief Registers an event type and hands its queue to the bus.
+             * @tparam E The event type.
+             * @param storage The queue of the event type.
+             * @return The ID of the event type.
+             * @throws Exception::Type::InvalidArgument if the event queue already exists.
+             */
+            template <Event E>
+            ID install(Unique<Storage<E>> storage) {
+                const ID id = world.events.enter<E>();
+                std::unique_lock lock(queuesLock);
+                if (id < queues.size() && queues[id]) {
+                    std::string msg = "Event queue for '" + Reflect::reflect<E>().getType().getName() + "' already exists";
+                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.c_str());
+                }
+                if (id >= queues.size()) {
+                    queues.resize(id + 1);
+                }
+                queues[id] = std::move(storage);
+                const u32 type = Registry::getTypeIndex<E>();
+                if (type < Registry::MaxTypes) {
+                    slots[type].store(queues[id].get(), std::memory_order_release);
+                }
+                return id;
+            }
         };
     }  // namespace Event
 }  // namespace rome::core
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 namespace rome::core {
     namespace Event {
+        std::atomic<u32> Registry::nextType{0};
+
         ID Registry::enter(const std::string& name) {
             {
                 std::shared_lock lock(eventsLock);
@@ -8,6 +8,8 @@ namespace rome::core {
     namespace Event {
         /**
          * @brief A registry for managing events and their unique runtime IDs.
+         * Every event type also gets a process-wide index the first time it is used, under which the registry caches its
+         * ID, so typed lookups after the first one skip the name map.
          * @warning This registry is not thread-safe outside event registration.
          */
         class RM_API Registry final {
@@ -44,23 +46,75 @@ namespace rome::core {
              */
             b8 contains(const std::string& name) const;
 
+            /**
+             * @brief Enters a new event into the registry by its type.
+             * @tparam E The type of the event.
+             * @return The unique ID of the event.
+             * @note This function is thread-safe, and lock-free once the type is entered.
+             */
+            template <Event E>
+            ID enter() {
+                const u32 type = getTypeIndex<E>();
+                if (type < MaxTypes) {
+                    if (const ID cached = slots[type].load(std::memory_order_acquire)) {
+                        return cached - 1;
+                    }
+                }
+                return cache(type, enter(Reflect::reflect<E>().getType().getName()));
+            }
+
             /**
              * @brief Retrieves the unique ID of an event by its type.
              * @tparam E The type of the event.
              * @return The unique ID of the event.
              * @throws Exception::Type::NotFound if the event does not exist.
-             * @warning This function is not thread-safe.
+             * @note This function is lock-free once the type is entered, but not thread-safe before.
              */
             template <Event E>
             ID get() const {
-                return get(Reflect::reflect<E>().name);
+                const u32 type = getTypeIndex<E>();
+                if (type < MaxTypes) {
+                    if (const ID cached = slots[type].load(std::memory_order_acquire)) {
+                        return cached - 1;
+                    }
+                }
+                return cache(type, get(Reflect::reflect<E>().getType().getName()));
+            }
+
+            /**
+             * @brief Gets the process-wide index of an event type, shared by every registry.
+             * @tparam E The type of the event.
+             * @return The index of the type, given on first use.
+             */
+            template <Event E>
+            static u32 getTypeIndex() noexcept {
+                static const u32 type = nextType.fetch_add(1, std::memory_order_relaxed);
+                return type;
             }
 
+            static constexpr u32 MaxTypes = 1024;  ///< The event types whose ID is cached, later ones use the name map.
+
             private:
-            mutable std::shared_mutex eventsLock;                                         ///< Mutex to protect the events map.
-            std::unordered_map<std::string, ID, TransparentSVHash, std::equal_to<>> ids;  ///< Maps event names to their IDs.
-            std::unordered_map<ID, std::string> names;                                    ///< Reverse lookup.
-            std::queue<ID> freeIDs;                                                       ///< Queue of free IDs for reuse.
+            mutable std::shared_mutex eventsLock;                                             ///< Mutex to protect the events map.
+            std::unordered_map<std::string, ID, TransparentSVHash, std::equal_to<>> ids;      ///< Maps event names to their IDs.
+            std::unordered_map<ID, std::string> names;                                        ///< Reverse lookup.
+            std::queue<ID> freeIDs;                                                           ///< Queue of free IDs for reuse.
+            Unique<std::atomic<ID>[]> slots = std::make_unique<std::atomic<ID>[]>(MaxTypes);  ///< The cached IDs plus one, by type index.
+
+            static std::atomic<u32> nextType;  ///< The index of the next event type.
+
+            /**
+             * @brief Caches the ID of an event type.
+             * @param type The index of the type.
+             * @param id The ID of the type.
+             * @return The ID.
+             */
+            ID cache(u32 type, ID id) const noexcept {
+                if (type < MaxTypes) {
+                    slots[type].store(id + 1, std::memory_order_release);
+                }
+                return id;
+            }
         };
     }  // namespace Event
 }  // namespace rome::core
\ No newline at end of file
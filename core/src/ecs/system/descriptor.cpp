@@ -15,6 +15,11 @@ namespace rome::core {
             return *this;
         }
 
+        Builder& Builder::reactive(b8 value) {
+            descriptor.reactive = value;
+            return *this;
+        }
+
         Builder& Builder::requireFull(b8 value) {
             descriptor.requireFull = value;
             return *this;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "container/bitset.hpp"
 #include "ecs/world.hpp"
 
@@ -11,16 +13,20 @@ namespace rome::core {
          * @brief A system's descriptor defines its static properties such as name, scheduling, etc.
          */
         struct RM_API Descriptor {
-            const World& world;                            ///< Reference to the world instance.
-            const std::string name = "null descriptor";    ///< The name of the system. Must be unique.
-            const std::function<void(Context&)> callback;  ///< The function to be called every time the system is executed.
-            BitSet<Component::ID> reads;                   ///< The components this system reads.
-            BitSet<Component::ID> writes;                  ///< The components this system writes.
-            BitSet<Event::ID> emits;                       ///< The events this system emits.
-            BitSet<Event::ID> listens;                     ///< The events this system listens to.
-            b8 requireFull = true;                         ///< Whether the system must operate on a full-owning group.
-            b8 allowPartial = false;                       ///< Whether the system can operate on partial groups.
-            b8 active = true;                              ///< Whether the system is currently active.
+            const World& world;                          ///< Reference to the world instance.
+            const std::string name = "null descriptor";  ///< The name of the system. Must be unique.
+            std::function<void(Context&)> callback;      ///< The function to be called every time the system is executed.
+            BitSet<Component::ID> reads;                 ///< The components this system reads.
+            BitSet<Component::ID> writes;                ///< The components this system writes.
+            BitSet<Event::ID> emits;                     ///< The events this system emits.
+            BitSet<Event::ID> listens;                   ///< The events this system listens to.
+            b8 requireFull = true;                       ///< Whether the system must operate on a full-owning group.
+            b8 allowPartial = false;                     ///< Whether the system can operate on partial groups.
+            b8 active = true;                            ///< Whether the system is currently active.
+            b8 reactive = false;                         ///< Whether the system only runs when an event it listens to is pending.
+            u64 lastRun = 0;                             ///< The tick of the system's last run, see Changed and Added.
+            BitSet<Component::ID> optionalReads = {};    ///< The components this system reads without requiring them.
+            BitSet<Component::ID> optionalWrites = {};   ///< The components this system writes without requiring them.
         };
 
         class RM_API Builder {
@@ -33,13 +39,13 @@ namespace rome::core {
             Builder& operator=(Builder&&) = delete;
 
             /**
-             * @brief Sets the name of the system.
-             * @param name The name to set.
+             * @brief Sets the components this system reads.
+             * @tparam Args The component types to read.
              * @return This builder instance for chaining.
              */
             template <Component::Component... Args>
             Builder& reads() {
-                descriptor.reads({world.components.enter<Args>()...});
+                descriptor.reads = BitSet<Component::ID>::create({world.components.enter<Args>()...});
                 return *this;
             }
 
@@ -50,7 +56,31 @@ namespace rome::core {
              */
             template <Component::Component... Args>
             Builder& writes() {
-                descriptor.writes({world.components.enter<Args>()...});
+                descriptor.writes = BitSet<Component::ID>::create({world.components.enter<Args>()...});
+                return *this;
+            }
+
+            /**
+             * @brief Sets the components this system reads through Optional or Exclude view terms.
+             * They take part in conflict detection like reads(), but the system's entities need not have them.
+             * @tparam Args The component types to read.
+             * @return This builder instance for chaining.
+             */
+            template <Component::Component... Args>
+            Builder& readsOptional() {
+                descriptor.optionalReads = BitSet<Component::ID>::create({world.components.enter<Args>()...});
+                return *this;
+            }
+
+            /**
+             * @brief Sets the components this system writes through mutable Optional view terms.
+             * They take part in conflict detection like writes(), but the system's entities need not have them.
+             * @tparam Args The component types to write to.
+             * @return This builder instance for chaining.
+             */
+            template <Component::Component... Args>
+            Builder& writesOptional() {
+                descriptor.optionalWrites = BitSet<Component::ID>::create({world.components.enter<Args>()...});
                 return *this;
             }
 
@@ -68,6 +98,13 @@ namespace rome::core {
              */
             Builder& listens(std::initializer_list<Event::ID> events);
 
+            /**
+             * @brief Sets whether the system only runs on updates where an event it listens to is pending.
+             * @param value Whether the system is reactive.
+             * @return This builder instance for chaining.
+             */
+            Builder& reactive(b8 value = true);
+
             /**
              * @brief Sets whether the system must operate on a full-owning group.
              * @param value Whether to require full ownership.
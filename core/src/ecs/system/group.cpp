@@ -9,7 +9,37 @@ namespace rome::core {
               partial(descriptor.allowPartial ? descriptor.reads - owning : BitSet<Component::ID>{}),
               emits(descriptor.emits),
               listens(descriptor.listens),
-              world(descriptor.world) {}
+              readable(descriptor.reads | descriptor.writes | descriptor.optionalReads | descriptor.optionalWrites),
+              writable(descriptor.writes | descriptor.optionalWrites),
+              world(descriptor.world) {
+            std::vector<Component::ID> owned;
+            std::vector<Component::ID> observed;
+            for (Component::ID id = 0; id < world.components.getCount(); id++) {
+                if (owning.test(id))
+                    owned.push_back(id);
+                else if (partial.test(id))
+                    observed.push_back(id);
+            }
+            (owning | partial).each([this](Component::ID id) { required.push_back(id); });
+            if (world.archetypal) {
+                // The pools stay empty on that backend, views match the archetypes against the required components instead
+                return;
+            }
+            if (!owned.empty() && !world.components.isOwnable(owned, observed)) {
+                // Another group already packs one of these pools, so track membership without packing
+                observed.insert(observed.end(), owned.begin(), owned.end());
+                std::ranges::sort(observed);
+                owned.clear();
+            }
+            if (!owned.empty() || !observed.empty()) {
+                ownership = &world.components.own(owned, observed);
+            }
+        }
+
+        Group::~Group() {
+            // Let later groups pack these pools, and stop paying for a packing nobody reads
+            if (ownership) world.components.disown(*ownership);
+        }
 
         Group::operator std::string() const { return toString(); }
 
@@ -31,12 +61,25 @@ namespace rome::core {
             return debug;
         }
 
-        const std::vector<Entity>& Group::getEntities() const noexcept { return entities; }
+        std::span<const u64> Group::getIndices() const noexcept { return ownership ? ownership->getIndices() : std::span<const u64>{}; }
 
-        u64 Group::getSize() const noexcept { return entities.size(); }
+        std::span<const Component::ID> Group::getRequired() const noexcept { return required; }
+
+        u64 Group::getSize() const noexcept {
+            if (world.archetypal) {
+                u64 size = 0;
+                world.archetypes.match(required, {}, [&](const Component::Archetype& archetype) { size += archetype.getSize(); });
+                return size;
+            }
+            return ownership ? ownership->getLength() : 0;
+        }
+
+        b8 Group::isPacked(Component::ID id) const noexcept {
+            return ownership && std::ranges::find(ownership->getOwned(), id) != ownership->getOwned().end();
+        }
 
         u64 Group::getOwned() const noexcept { return owning.count(); }
 
-        b8 Group::isEmpty() const noexcept { return entities.empty(); }
+        b8 Group::isEmpty() const noexcept { return getSize() == 0; }
     }  // namespace System
 }  // namespace rome::core
\ No newline at end of file
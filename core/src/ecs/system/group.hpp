@@ -12,13 +12,20 @@ namespace rome::core {
 
         class RM_API Group final {
             public:
-            const BitSet<Component::ID> owning;   ///< The components that this group fully owns.
-            const BitSet<Component::ID> partial;  ///< The components that this group partially owns.
-            const BitSet<Event::ID> emits;        ///< The events this group emits.
-            const BitSet<Event::ID> listens;      ///< The events this group is interested in.
+            const BitSet<Component::ID> owning;    ///< The components that this group fully owns.
+            const BitSet<Component::ID> partial;   ///< The components that this group partially owns.
+            const BitSet<Event::ID> emits;         ///< The events this group emits.
+            const BitSet<Event::ID> listens;       ///< The events this group is interested in.
+            const BitSet<Component::ID> readable;  ///< Every component the system declared access to, optional ones included.
+            const BitSet<Component::ID> writable;  ///< Every component the system declared it writes, optional ones included.
 
+            /**
+             * @brief Creates the group of a system, packing the pools it owns if no other group packs them yet.
+             * On the archetype backend nothing is packed: the group matches the archetypes holding its components instead.
+             * @param descriptor The system's descriptor.
+             */
             Group(const Descriptor& descriptor);
-            ~Group() = default;
+            ~Group();
             Group(const Group&) = delete;
             Group& operator=(const Group&) = delete;
             Group(Group&&) = delete;
@@ -37,17 +44,31 @@ namespace rome::core {
             std::string toString() const;
 
             /**
-             * @brief Returns the entities currently in this group.
-             * @return A vector of entities in this group.
+             * @brief Returns the indices of the entities currently in this group.
+             * @return A span over the entity indices, in the packed order shared by every owned pool.
+             */
+            std::span<const u64> getIndices() const noexcept;
+
+            /**
+             * @brief Returns the components an entity must have to be in this group.
+             * @return The sorted component IDs, owned and partial alike.
              */
-            const std::vector<Entity>& getEntities() const noexcept;
+            std::span<const Component::ID> getRequired() const noexcept;
 
             /**
              * @brief Returns the number of entities in this group.
-             * @return The number of entities in this group.
+             * @return The number of entities in this group, summed over the matching archetypes on the archetype backend.
              */
             u64 getSize() const noexcept;
 
+            /**
+             * @brief Checks whether a component's pool is packed in the group's order.
+             * A group falls back to observing its components when another group already packs one of their pools.
+             * @param id The component ID.
+             * @return True if the group's entities sit at the front of the component's pool, false otherwise.
+             */
+            b8 isPacked(Component::ID id) const noexcept;
+
             /**
              * @brief Returns the number of components this group fully owns.
              * @return The number of components this group fully owns.
@@ -61,8 +82,9 @@ namespace rome::core {
             b8 isEmpty() const noexcept;
 
             private:
-            const World& world;            ///< The world instance for accessing ECS data.
-            std::vector<Entity> entities;  ///< The entities that match this group.
+            const World& world;                         ///< The world instance for accessing ECS data.
+            std::vector<Component::ID> required;        ///< The components an entity must have to be in the group.
+            Component::Ownership* ownership = nullptr;  ///< Tracks the group's entities, null if the group has no components.
         };
 
     }  // namespace System
@@ -6,18 +6,20 @@ namespace rome::core {
     namespace System {
         ID Registry::enter(Descriptor&& descriptor) {
             std::unique_lock lock(systemsLock);
+            if (ids.find(descriptor.name) != ids.end()) {
+                THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "Duplicate system name");
+            }
+            // Build the group first, so a system it rejects leaves nothing behind
+            Unique<Group> group = MakeUnique<Group>(descriptor);
+
             ID id;
             if (!freeIDs.empty()) {
                 id = freeIDs.front();
                 freeIDs.pop();
             } else {
-                static ID nextId = 0;
-                id = nextId++;
+                id = nextID++;
             }
 
-            if (ids.find(descriptor.name) != ids.end()) {
-                THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "Duplicate system name");
-            }
             if (descriptors.find(id) != descriptors.end()) {
                 THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "Duplicate system ID");
             }
@@ -25,6 +27,9 @@ namespace rome::core {
             ids.emplace(descriptor.name, id);
             names.emplace(id, descriptor.name);
             descriptors.emplace(id, std::move(descriptor));
+            groups.emplace(id, std::move(group));
+            order.push_back(id);
+            revision++;
 
             return id;
         }
@@ -49,14 +54,26 @@ namespace rome::core {
             }
         }
 
+        const Group& Registry::getGroup(ID id) const {
+            auto it = groups.find(id);
+            if (it == groups.end()) {
+                std::string msg = "System with ID " + std::to_string(id) + " not found";
+                THROW_CORE_EXCEPTION(Exception::Type::NotFound, msg.c_str());
+            }
+            return *it->second;
+        }
+
         void Registry::erase(ID id) {
             std::unique_lock lock(systemsLock);
             auto it = descriptors.find(id);
             if (it == descriptors.end()) return;
             ids.erase(names[id]);
             names.erase(id);
+            groups.erase(id);
             descriptors.erase(it);
+            std::erase(order, id);
             freeIDs.push(id);
+            revision++;
         }
     }  // namespace System
 }  // namespace rome::core
\ No newline at end of file
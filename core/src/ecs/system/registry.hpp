@@ -16,7 +16,7 @@ namespace rome::core {
             Registry& operator=(Registry&&) = delete;
 
             /**
-             * @brief Registers a new system with the given descriptor.
+             * @brief Registers a new system with the given descriptor and builds the group it iterates.
              * @return The ID of the newly registered system.
              * @throws Exception::Type::InvalidArgument if a system with the same name already exists.
              * @throws Exception::Type::InvalidArgument if a system with the same ID already exists.
@@ -49,6 +49,29 @@ namespace rome::core {
              */
             const Descriptor& get(ID id) const;
 
+            /**
+             * @brief Retrieves the group a system iterates.
+             * @param id The ID of the system.
+             * @return A const reference to the system's group.
+             * @warning This function is not thread-safe.
+             * @throws Exception::Type::NotFound if the ID is not registered.
+             */
+            const Group& getGroup(ID id) const;
+
+            /**
+             * @brief Gets the IDs of every registered system, in registration order.
+             * @return The registered system IDs.
+             * @warning This function is not thread-safe.
+             */
+            inline const std::vector<ID>& getOrder() const noexcept { return order; }
+
+            /**
+             * @brief Gets a counter bumped every time a system is registered or removed.
+             * @return The current revision of the registry.
+             * @warning This function is not thread-safe.
+             */
+            inline u64 getRevision() const noexcept { return revision; }
+
             /**
              * @brief Removes a system by ID. Its ID becomes reusable.
              * @param id The ID of the system to remove.
@@ -59,11 +82,14 @@ namespace rome::core {
 
             private:
             mutable std::shared_mutex systemsLock;                                        ///< Mutex for thread-safe access.
-            std::vector<Group> groups;                                                    ///< The groups managed by this registry.
+            std::unordered_map<ID, Unique<Group>> groups;                                 ///< Maps system IDs to the groups they iterate.
             std::unordered_map<std::string, ID, TransparentSVHash, std::equal_to<>> ids;  ///< Maps system names to their IDs.
             std::unordered_map<ID, const std::string> names;                              ///< Reverse lookup.
             std::unordered_map<ID, Descriptor> descriptors;                               ///< Maps system IDs to their descriptors.
             std::queue<ID> freeIDs;                                                       ///< Queue of free IDs for reuse.
+            std::vector<ID> order;                                                        ///< System IDs in registration order.
+            ID nextID = 0;                                                                ///< The next never-used system ID.
+            u64 revision = 0;                                                             ///< Bumped on every registration or removal.
         };
     }  // namespace System
 }  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "ecs/system/scheduler.hpp"
+
+#include "ecs/event/bus.hpp"
+#include "ecs/system/descriptor.hpp"
+
+namespace rome::core {
+    namespace System {
+        Scheduler::Scheduler(World& world, JobSystem& jobs) : world(world), jobs(jobs) {}
+
+        void Scheduler::run() {
+            getStages();
+            world.commands.playback(world);
+            world.bus.swap();
+            awake.clear();
+            world.bus.wake([this](u32 system) { awake.set(system); });
+            skipped = 0;
+
+            std::vector<ID> ready;
+            for (const std::vector<ID>& stage : stages) {
+                ready.clear();
+                for (ID id : stage) {
+                    const Descriptor& descriptor = world.systems.get(id);
+                    if (!descriptor.active || !descriptor.callback) {
+                        continue;
+                    }
+                    if (descriptor.reactive && !awake.test(id)) {
+                        skipped++;
+                        continue;
+                    }
+                    ready.push_back(id);
+                }
+                if (ready.empty()) {
+                    continue;
+                }
+
+                JobSystem::Counter counter;
+                for (u64 i = 1; i < ready.size(); i++) {
+                    jobs.submit([this, id = ready[i]]() { execute(id); }, &counter);
+                }
+                try {
+                    execute(ready.front());
+                } catch (...) {
+                    jobs.wait(counter);
+                    throw;
+                }
+                jobs.wait(counter);
+                world.commands.playback(world);
+            }
+        }
+
+        const std::vector<std::vector<ID>>& Scheduler::getStages() {
+            if (revision != world.systems.getRevision()) {
+                build();
+            }
+            return stages;
+        }
+
+        std::string Scheduler::toString() {
+            std::string debug;
+            const std::vector<std::vector<ID>>& layout = getStages();
+            for (u64 i = 0; i < layout.size(); i++) {
+                debug += "Stage " + std::to_string(i) + ":";
+                for (ID id : layout[i]) {
+                    debug += " " + world.systems.get(id).name;
+                }
+                debug += "\n";
+            }
+            return debug;
+        }
+
+        b8 Scheduler::conflicts(const Descriptor& first, const Descriptor& second) noexcept {
+            // Optional accesses are not required by the groups, but touch the same data all the same
+            const BitSet<Component::ID> firstReads = first.reads | first.optionalReads;
+            const BitSet<Component::ID> firstWrites = first.writes | first.optionalWrites;
+            const BitSet<Component::ID> secondReads = second.reads | second.optionalReads;
+            const BitSet<Component::ID> secondWrites = second.writes | second.optionalWrites;
+            return firstWrites.intersects(secondReads) || firstWrites.intersects(secondWrites) || secondWrites.intersects(firstReads) ||
+                   first.emits.intersects(second.listens) || second.emits.intersects(first.listens);
+        }
+
+        void Scheduler::build() {
+            const std::vector<ID>& order = world.systems.getOrder();
+            std::vector<u64> levels(order.size(), 0);
+            stages.clear();
+            world.bus.clearListeners();
+            for (u64 i = 0; i < order.size(); i++) {
+                const Descriptor& descriptor = world.systems.get(order[i]);
+                descriptor.listens.each([&](Event::ID event) { world.bus.listen(event, order[i]); });
+                for (u64 j = 0; j < i; j++) {
+                    if (levels[j] >= levels[i] && conflicts(world.systems.get(order[j]), descriptor)) {
+                        levels[i] = levels[j] + 1;
+                    }
+                }
+                if (levels[i] >= stages.size()) {
+                    stages.resize(levels[i] + 1);
+                }
+                stages[levels[i]].push_back(order[i]);
+            }
+            revision = world.systems.getRevision();
+        }
+
+        void Scheduler::execute(ID id) {
+            Descriptor& descriptor = world.systems.get(id);
+            const u64 tick = world.components.advance();
+            // The thread may be running this system while another waits on its jobs, so give that one its keys back
+            Command::Buffer::Scope commands(world.commands.local(), Command::Buffer::Task{id});
+            Event::Queue::Scope events(id, 0);
+            Context context{world.systems.getGroup(id), world, descriptor.lastRun, tick};
+            descriptor.callback(context);
+            descriptor.lastRun = tick;
+        }
+    }  // namespace System
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "concurrency/jobs.hpp"
+#include "ecs/system/registry.hpp"
+
+namespace rome::core {
+    namespace System {
+        /**
+         * @brief Runs the registered systems in stages derived from their descriptors.
+         * Two systems conflict when one writes a component the other reads or writes, or emits an event the other listens to.
+         * Conflicting systems keep their registration order; every system lands in the earliest stage after all of the
+         * earlier-registered systems it conflicts with, and the systems of a stage run concurrently on the job system.
+         * @note The stage layout is rebuilt lazily whenever a system is registered or removed.
+         * @warning This class is not thread-safe.
+         */
+        class RM_API Scheduler final {
+            public:
+            /**
+             * @brief Creates a scheduler for the systems of a world.
+             * @param world The world whose systems are scheduled.
+             * @param jobs The job system running the systems of a stage (default is the shared one).
+             */
+            explicit Scheduler(World& world, JobSystem& jobs = JobSystem::getInstance());
+            ~Scheduler() = default;
+            Scheduler(const Scheduler&) = delete;
+            Scheduler& operator=(const Scheduler&) = delete;
+            Scheduler(Scheduler&&) = delete;
+            Scheduler& operator=(Scheduler&&) = delete;
+
+            /**
+             * @brief Runs every active system once, stage by stage.
+             * The event bus is swapped first, so the events emitted during the previous run become readable, and reactive
+             * systems none of whose listened events are pending are skipped.
+             * @note Each stage waits for the previous one to finish, then the commands its systems deferred are played
+             *       back. The calling thread runs one system of every stage, then helps with the others.
+             * @throws The first exception thrown by a system of the failing stage, once the whole stage has finished.
+             */
+            void run();
+
+            /**
+             * @brief Gets the number of reactive systems skipped by the last run for lack of events.
+             * @return The number of skipped systems.
+             */
+            inline u64 getSkipped() const noexcept { return skipped; }
+
+            /**
+             * @brief Gets the stage layout, rebuilding it if the registered systems changed.
+             * @return The system IDs of every stage, in execution order.
+             */
+            const std::vector<std::vector<ID>>& getStages();
+
+            /**
+             * @brief Returns a debug string representation of the stage layout.
+             * @return One line per stage listing the names of its systems.
+             */
+            std::string toString();
+
+            /**
+             * @brief Checks whether two systems must not run concurrently.
+             * @param first The first system.
+             * @param second The second system.
+             * @return True if their component or event accesses conflict, false otherwise.
+             */
+            static b8 conflicts(const Descriptor& first, const Descriptor& second) noexcept;
+
+            private:
+            World& world;                         ///< The world whose systems are scheduled.
+            JobSystem& jobs;                      ///< Runs the systems of a stage.
+            std::vector<std::vector<ID>> stages;  ///< The system IDs of every stage.
+            u64 revision = ~0ull;                 ///< The registry revision the stages were built for.
+            BitSet<ID> awake;                     ///< The systems with pending events in the current run.
+            u64 skipped = 0;                      ///< The number of reactive systems skipped by the last run.
+
+            /**
+             * @brief Rebuilds the stage layout from the registered systems.
+             */
+            void build();
+
+            /**
+             * @brief Runs a single system on the calling thread.
+             * @param id The ID of the system.
+             */
+            void execute(ID id);
+        };
+    }  // namespace System
+}  // namespace rome::core
\ No newline at end of file
@@ -1,107 +1,526 @@
 #pragma once
 
+#include "concurrency/jobs.hpp"
+#include "ecs/command/buffer.hpp"
+#include "ecs/event/bus.hpp"
 #include "ecs/system/group.hpp"
-#include "ecs/world.hpp"
 
 namespace rome::core {
     namespace System {
-        // Helpers to find the index of a type in a parameter pack.
-        template <typename T, typename... List>
-        struct index_of;
-        template <typename T, typename First, typename... Rest>
-        struct index_of<T, First, Rest...> {
-            static constexpr u64 value = std::is_same<T, First>::value ? 0 : 1 + index_of<T, Rest...>::value;
-        };
-        template <typename T>
-        struct index_of<T> {
-            STATIC_ASSERT(sizeof(T) == 0, "Type not found in index_of");
-        };
-
         struct Group;
         struct RM_API Context {
             const Group& group;  ///< The group this system is operating on.
             World& world;        ///< Reference to the world instance.
+            u64 lastRun = 0;     ///< The tick of the system's previous run, Changed and Added filters look past it.
+            u64 tick = 0;        ///< The tick of this run, stamped on the components views hand out mutably.
+
+            /**
+             * @brief Gets the calling thread's command buffer, to defer structural changes until the end of the stage.
+             * @return The command buffer.
+             */
+            Command::Buffer& getCommands() const { return world.commands.local(); }
+        };
+
+        /**
+         * @brief A view filter keeping the entities whose T component was added since the system last ran.
+         * @tparam T The component type, which the entities need not all have.
+         */
+        template <Component::Component T>
+        struct Added {
+            using Type = T;
+
+            static b8 test(const Component::Ticks& ticks, u64 since) noexcept { return ticks.added > since; }
+        };
+
+        /**
+         * @brief A view filter keeping the entities whose T component was added or changed since the system last ran.
+         * Views mark a component changed whenever they hand it out mutably, whether or not it is written to.
+         * @tparam T The component type, which the entities need not all have.
+         */
+        template <Component::Component T>
+        struct Changed {
+            using Type = T;
+
+            static b8 test(const Component::Ticks& ticks, u64 since) noexcept { return ticks.changed > since; }
         };
 
-        template <Component::Component... Components>
-        class RM_API ViewIterator final {
+        /**
+         * @brief A view filter skipping the entities that have any of the given components.
+         * The system must declare the components with Builder::readsOptional, since other systems may add or remove them.
+         * @tparam Ts The excluded component types.
+         */
+        template <Component::Component... Ts>
+        struct Exclude {};
+
+        /**
+         * @brief A view term fetching a component the entities need not have, as a pointer that is null when they lack it.
+         * The system must declare the component with Builder::readsOptional, or writesOptional if T is mutable.
+         * @tparam T The component type, const for read-only access.
+         */
+        template <Component::Component T>
+        struct Optional {};
+
+        // Helpers to split the terms of a view into the components it fetches, the filters it applies and the components it
+        // excludes.
+        template <typename T>
+        struct term {
+            using fetches = std::tuple<T>;
+            using filters = std::tuple<>;
+            using excludes = std::tuple<>;
+        };
+        template <typename T>
+        struct term<Added<T>> {
+            using fetches = std::tuple<>;
+            using filters = std::tuple<Added<T>>;
+            using excludes = std::tuple<>;
+        };
+        template <typename T>
+        struct term<Changed<T>> {
+            using fetches = std::tuple<>;
+            using filters = std::tuple<Changed<T>>;
+            using excludes = std::tuple<>;
+        };
+        template <typename... Ts>
+        struct term<Exclude<Ts...>> {
+            using fetches = std::tuple<>;
+            using filters = std::tuple<>;
+            using excludes = std::tuple<Ts...>;
+        };
+        template <typename... Terms>
+        using fetches_t = decltype(std::tuple_cat(std::declval<typename term<Terms>::fetches>()...));
+        template <typename... Terms>
+        using filters_t = decltype(std::tuple_cat(std::declval<typename term<Terms>::filters>()...));
+        template <typename... Terms>
+        using excludes_t = decltype(std::tuple_cat(std::declval<typename term<Terms>::excludes>()...));
+
+        // Helpers to tell the component behind a fetched term, and whether the term is optional.
+        template <typename T>
+        struct fetched {
+            using Type = T;
+            static constexpr b8 optional = false;
+        };
+        template <typename T>
+        struct fetched<Optional<T>> {
+            using Type = T;
+            static constexpr b8 optional = true;
+        };
+        template <typename T>
+        using component_t = remove_all_qualifiers_t<typename fetched<T>::Type>;
+
+        template <typename Fetches, typename Filters, typename Excludes>
+        class BasicView;
+
+        /**
+         * @brief Iterates over the entities of a system's group, fetching some of their components.
+         * The group keeps the entities holding every component it requires, so it is never larger than the smallest of
+         * those pools and drives the iteration; filters and exclusions are then tested per entity.
+         * On the archetype backend the view instead walks the chunks of every archetype matching the group, which keeps
+         * every fetch linear. Archetypes keep no ticks, so Added and Changed filters are not supported there.
+         * @tparam Fetches The fetched terms: components, const for read-only access, or Optional components.
+         * @tparam Filters The filters an entity must pass to be visited, see Added and Changed.
+         * @tparam Excludes The components an entity must not have to be visited, see Exclude.
+         */
+        template <typename... Fetches, typename... Filters, Component::Component... Excludes>
+        class RM_API BasicView<std::tuple<Fetches...>, std::tuple<Filters...>, std::tuple<Excludes...>> final {
             public:
-            ViewIterator(const std::tuple<remove_all_qualifiers_t<Components>*...>& owned,
-                         const std::tuple<Component::Pool<remove_all_qualifiers_t<Components>>*...>& pools, const Entity* entities, u64 index,
-                         u64 max)
-                : owned(owned), pools(pools), entities(entities), index(index), max(max) {}
-
-            bool operator!=(const ViewIterator& iter) const { return index != iter.index; }
-            ViewIterator& operator++() {
-                index++;
-                return *this;
-            }
-
-            decltype(auto) operator*() const {
-                return std::apply(
-                    [this](auto*... owned) {
-                        return std::apply(
-                            [this, owned...](auto*... pool) { return std::forward_as_tuple(fetch<Components>(owned, pool, entities[index])...); },
-                            pools);
+            class Iterator final {
+                public:
+                Iterator(const BasicView& view, u64 index) : view(view), index(view.skip(index)) {}
+
+                bool operator!=(const Iterator& iter) const { return index != iter.index; }
+                Iterator& operator++() {
+                    index = view.skip(index + 1);
+                    return *this;
+                }
+
+                decltype(auto) operator*() const { return view.tie(index, std::index_sequence_for<Fetches...>{}); }
+
+                private:
+                const BasicView& view;
+                u64 index;
+            };
+
+            /**
+             * @brief Creates a view over the group of a system.
+             * @param ctx The context of the system.
+             * @throws Exception::Type::InvalidArgument if the view accesses a component outside its group the system did not declare.
+             * @throws Exception::Type::NotSupported if the view filters on Added or Changed on the archetype backend.
+             */
+            explicit BasicView(Context& ctx)
+                : components(ctx.world.components),
+                  commands(ctx.world.commands),
+                  indices(ctx.group.getIndices().data()),
+                  count(ctx.group.getSize()),
+                  since(ctx.lastRun),
+                  now(ctx.tick),
+                  archetypal(ctx.world.archetypal) {
+                (declared<Fetches>(ctx), ...);
+                (require(ctx, ctx.world.components.enter<Excludes>(), false), ...);
+                if (archetypal) {
+                    if constexpr (sizeof...(Filters) > 0) {
+                        THROW_CORE_EXCEPTION(Exception::Type::NotSupported, "View filters need component ticks, which archetypes do not keep");
+                    }
+                    gather(ctx, std::index_sequence_for<Fetches...>{});
+                    return;
+                }
+                source(ctx, std::index_sequence_for<Fetches...>{});
+                filter(ctx, std::index_sequence_for<Filters...>{});
+                if constexpr (sizeof...(Excludes) > 0) {
+                    excluded = ctx.world.components.getMask<Excludes...>();
+                    // Nobody can have a component whose pool is empty, so only test the exclusions that can reject anything
+                    excluding = (... || !ctx.world.components.getPool<Excludes>()->getIndices().empty());
+                }
+            }
+
+            Iterator begin() const { return Iterator{*this, 0}; }
+            Iterator end() const { return Iterator{*this, count}; }
+
+            /**
+             * @brief Calls a function for every entity in the view, passing the fetched terms as separate arguments.
+             * @tparam Function The type of the function, invocable with (Components&..., Optional components as pointers).
+             * @param function The function to call.
+             */
+            template <typename Function>
+            void each(Function&& function) const {
+                walk(function, 0, count, std::index_sequence_for<Fetches...>{});
+            }
+
+            /**
+             * @brief Splits the view over a job system and calls a function for every entity, from several threads at once.
+             * @tparam Function The type of the function, invocable with (Components&..., Optional components as pointers).
+             * @param function The function to call. It must be safe to call concurrently for different entities.
+             * @param grain The number of entities per batch, or 0 to let the job system decide.
+             * @param jobs The job system to run on (default is the shared one).
+             * @note Returns once every entity has been visited. The calling thread visits entities too.
+             *       Every batch records its commands into a sub-task of the caller's, and pushes its events under the
+             *       sub-task's position, so both play back in batch order.
+             */
+            template <typename Function>
+            void parallelEach(Function&& function, u64 grain = 0, JobSystem& jobs = JobSystem::getInstance()) const {
+                if (count == 0) return;
+                grain = grain == 0 ? jobs.getGrain(count) : grain;
+                const u64 batches = (count + grain - 1) / grain;
+                Command::Buffer& caller = commands.local();
+                const Command::Buffer::Task task = caller.getTask();
+                jobs.parallelFor(
+                    0, count,
+                    [this, &function, &task, grain, batches](u64 first, u64 last) {
+                        const Command::Buffer::Task batch = task.split(first / grain, batches + 1);
+                        Command::Buffer::Scope scope(commands.local(), batch);
+                        Event::Queue::Scope events(batch.key, batch.first);
+                        walk(function, first, last, std::index_sequence_for<Fetches...>{});
                     },
-                    owned);
+                    grain);
+                // What the caller records or pushes next plays back after every batch
+                const Command::Buffer::Task next = task.split(batches, batches + 1);
+                caller.setTask(next);
+                Event::Queue::setKey(next.key, next.first);
+            }
+
+            /**
+             * @brief Calls a function with contiguous spans of components, one span per component type, all of the same length.
+             * The i-th element of every span belongs to the same entity. Every mutable span is marked changed up front.
+             * On the archetype backend spans never cross an archetype chunk.
+             * @tparam Function The type of the function, invocable with (std::span<Components>...).
+             * @param function The function to call.
+             * @param size The maximum length of a span, or 0 for a single span covering the whole view (or chunk).
+             * @throws Exception::Type::InvalidArgument if the group does not pack every component of the view.
+             */
+            template <typename Function>
+            void chunks(Function&& function, u64 size = 0) const {
+                STATIC_ASSERT(!filtering, "View chunks cannot be filtered");
+                STATIC_ASSERT(!(... || fetched<Fetches>::optional), "View chunks cannot fetch optional components");
+                if (archetypal) {
+                    for (const Run& run : runs) {
+                        slice(function, run, size == 0 ? run.size : size, std::index_sequence_for<Fetches...>{});
+                    }
+                    return;
+                }
+                if (!std::apply([](auto*... data) { return (... && (data != nullptr)); }, owned)) {
+                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, "View chunks require every component to be packed by the group");
+                }
+                size = size == 0 ? count : size;
+                for (u64 first = 0; first < count; first += size) {
+                    const u64 length = std::min(size, count - first);
+                    touch(first, first + length, std::index_sequence_for<Fetches...>{});
+                    std::apply([&](auto*... data) { function(std::span<Fetches>(data + first, length)...); }, owned);
+                }
             }
 
+            /**
+             * @brief Gets the number of entities in the group, an upper bound on the entities the view visits.
+             * @return The number of entities, 0 when a filter is known to reject them all.
+             */
+            inline u64 getSize() const noexcept { return count; }
+
             private:
-            const std::tuple<remove_all_qualifiers_t<Components>*...> owned;
-            const std::tuple<Component::Pool<remove_all_qualifiers_t<Components>>*...> pools;
-            const Entity* entities;
-            const u64 max;
-            u64 index;
-
-            template <class T>
-            static decltype(auto) fetch(auto* owned, auto* pool, Entity e) {
-                if (owned) {
-                    if constexpr (std::is_const_v<T>)
-                        return static_cast<const remove_all_qualifiers_t<T>&>(*(owned));
-                    else
-                        return static_cast<remove_all_qualifiers_t<T>&>(*(owned));
+            static constexpr b8 filtering = sizeof...(Filters) + sizeof...(Excludes) > 0;  ///< Whether entities are tested.
+
+            /**
+             * @brief A run of entities stored in the same archetype chunk.
+             */
+            struct Run {
+                u64 first;                                   ///< The position of the run's first entity in the view.
+                u64 size;                                    ///< The number of entities in the run.
+                std::array<void*, sizeof...(Fetches)> data;  ///< The column of every fetched term, null for a missing Optional.
+            };
+
+            std::tuple<component_t<Fetches>*...> owned;                        ///< The packed data of every component, null if unpacked.
+            std::tuple<Component::Pool<component_t<Fetches>>*...> pools;       ///< The pool of every component.
+            std::tuple<Component::Pool<typename Filters::Type>*...> filtered;  ///< The pool of every filtered component.
+            std::array<b8, sizeof...(Filters)> packed{};                       ///< Whether each filtered component is packed.
+            const Component::Registry& components;                             ///< Holds the signatures tested against excluded.
+            Command::Queue& commands;                                          ///< Hands every batch of parallelEach its buffer.
+            Component::Signature excluded;                                     ///< The excluded components.
+            b8 excluding = false;                                              ///< Whether an excluded component has any entity.
+            const u64* indices;                                                ///< The entities of the group.
+            u64 count;                                                         ///< The number of entities in the group.
+            const u64 since;                                                   ///< The tick filters look past.
+            const u64 now;                                                     ///< The tick stamped on mutable fetches.
+            const b8 archetypal;                                               ///< Whether the view walks archetype chunks.
+            std::vector<Run> runs;                                             ///< The matching chunks, on the archetype backend.
+
+            /**
+             * @brief Checks that the system declared the component of an Optional term, writable if fetched mutably.
+             * Optional components are outside the group, so only the declaration lets the scheduler see the access.
+             * @tparam Term The fetched term, ignored unless Optional.
+             * @param ctx The context of the system.
+             */
+            template <typename Term>
+            static void declared(Context& ctx) {
+                if constexpr (fetched<Term>::optional) {
+                    require(ctx, ctx.world.components.enter<component_t<Term>>(), !std::is_const_v<typename fetched<Term>::Type>);
+                }
+            }
+
+            /**
+             * @brief Checks that the system declared access to a component outside its group.
+             * @param ctx The context of the system.
+             * @param id The component ID.
+             * @param mutating Whether the component is written.
+             * @throws Exception::Type::InvalidArgument if the access is undeclared, see Builder::readsOptional and writesOptional.
+             */
+            static void require(Context& ctx, Component::ID id, b8 mutating) {
+                if (!(mutating ? ctx.group.writable : ctx.group.readable).test(id)) {
+                    std::string msg = "View accesses '" + ctx.world.components.getName(id) + "' without the system declaring it" +
+                                      (mutating ? " written" : "");
+                    THROW_CORE_EXCEPTION(Exception::Type::InvalidArgument, msg.c_str());
+                }
+            }
+
+            template <std::size_t... I>
+            void source(Context& ctx, std::index_sequence<I...>) {
+                const std::array<b8, sizeof...(Fetches)> isPacked{ctx.group.isPacked(ctx.world.components.enter<component_t<Fetches>>())...};
+                ((std::get<I>(pools) = ctx.world.components.getPool<component_t<Fetches>>()), ...);
+                ((std::get<I>(owned) = isPacked[I] ? std::get<I>(pools)->getData().first : nullptr), ...);
+            }
+
+            /**
+             * @brief Collects the chunks of every archetype holding the group's components, the fetched ones and no excluded one.
+             * Archetypes hold every component of their entities, so exclusions are settled per archetype rather than per entity.
+             * @param ctx The context of the system.
+             */
+            template <std::size_t... I>
+            void gather(Context& ctx, std::index_sequence<I...>) {
+                const std::array<Component::ID, sizeof...(Fetches)> ids{ctx.world.components.enter<component_t<Fetches>>()...};
+                const std::array<Component::ID, sizeof...(Excludes)> excludes{ctx.world.components.enter<Excludes>()...};
+                std::vector<Component::ID> required(ctx.group.getRequired().begin(), ctx.group.getRequired().end());
+                ((fetched<Fetches>::optional ? void() : required.push_back(ids[I])), ...);
+                count = 0;
+                ctx.world.archetypes.match(required, excludes, [&](Component::Archetype& archetype) {
+                    const std::array<u32, sizeof...(Fetches)> columns{archetype.find(ids[I])...};
+                    for (u64 chunk = 0; chunk < archetype.getChunkCount(); chunk++) {
+                        const u64 size = archetype.getChunkSize(chunk);
+                        runs.push_back(
+                            Run{count, size, {columns[I] == Component::Archetype::npos ? nullptr : archetype.getColumn(columns[I], chunk)...}});
+                        count += size;
+                    }
+                });
+            }
+
+            /**
+             * @brief Finds the run holding a position of the view.
+             * @param position The position, which must be less than the size of the view.
+             * @return An iterator to the run.
+             */
+            auto locate(u64 position) const {
+                return std::prev(std::ranges::upper_bound(runs, position, {}, &Run::first));
+            }
+
+            /**
+             * @brief Fetches a term for a row of a run. Archetypes keep no ticks, so nothing is marked changed.
+             * @tparam I The index of the term.
+             * @param run The run holding the entity.
+             * @param row The row of the entity in the run.
+             * @return A reference to the component, or a pointer that is null when an Optional component is missing.
+             */
+            template <std::size_t I>
+            decltype(auto) take(const Run& run, u64 row) const {
+                using Term = std::tuple_element_t<I, std::tuple<Fetches...>>;
+                using T = typename fetched<Term>::Type;
+                T* data = static_cast<T*>(run.data[I]);
+                if constexpr (fetched<Term>::optional) {
+                    return data ? data + row : static_cast<T*>(nullptr);
                 } else {
-                    if constexpr (std::is_const_v<T>)
-                        return static_cast<const remove_all_qualifiers_t<T>&>(pool->get(e));
-                    else
-                        return static_cast<remove_all_qualifiers_t<T>&>(pool->get(e));
+                    return data[row];
                 }
             }
-        };
 
-        template <Component::Component... Components>
-        class RM_API View final {
-            public:
-            explicit View(Context& ctx) : count(ctx.group.getSize()) {
-                auto entities = ctx.group.getEntities();
-                this->entities = entities.data();
+            /**
+             * @brief Calls a function with spans of at most the given length over a run.
+             */
+            template <typename Function, std::size_t... I>
+            void slice(Function& function, const Run& run, u64 size, std::index_sequence<I...>) const {
+                for (u64 first = 0; first < run.size; first += size) {
+                    const u64 length = std::min(size, run.size - first);
+                    function(std::span<Fetches>(static_cast<Fetches*>(run.data[I]) + first, length)...);
+                }
+            }
+
+            template <std::size_t... I>
+            void filter(Context& ctx, std::index_sequence<I...>) {
+                ((packed[I] = ctx.group.isPacked(ctx.world.components.enter<typename Filters::Type>())), ...);
+                ((std::get<I>(filtered) = ctx.world.components.getPool<typename Filters::Type>()), ...);
+                // Nothing was added nor changed in an empty pool
+                if ((... || std::get<I>(filtered)->getIndices().empty())) {
+                    count = 0;
+                }
+            }
 
-                (void)std::initializer_list<int>{(source<Components>(ctx), 0)...};
+            /**
+             * @brief Checks whether the entity at a position of the view passes every filter and exclusion.
+             * @param position The position of the entity in the group.
+             * @return True if the entity should be visited, false otherwise.
+             */
+            b8 accepts(u64 position) const noexcept {
+                if (excluding && components.getSignature(indices[position]).intersects(excluded)) {
+                    return false;
+                }
+                return accepts(position, std::index_sequence_for<Filters...>{});
             }
 
-            ViewIterator<Components...> begin() const { return ViewIterator<Components...>{owned, pools, entities, 0, count}; }
-            ViewIterator<Components...> end() const { return ViewIterator<Components...>{owned, pools, entities, count, count}; }
+            template <std::size_t... I>
+            b8 accepts([[maybe_unused]] u64 position, std::index_sequence<I...>) const noexcept {
+                return (... && passes<Filters>(std::get<I>(filtered), packed[I], position));
+            }
 
-            private:
-            template <Component::Component T>
-            void source(Context& ctx) {
-                constexpr u64 index = index_of<remove_all_qualifiers_t<T>, remove_all_qualifiers_t<Components>...>::value;
-                auto* pool = ctx.world.components.getPool<remove_all_qualifiers_t<T>>();
-                auto [ptr, _] = pool->getData();
-                if (ctx.group.owning.test(ctx.world.components.enter<remove_all_qualifiers_t<T>>())) {
-                    std::get<index>(owned) = ptr;
-                    std::get<index>(pools) = nullptr;
+            /**
+             * @brief Checks whether the entity at a position of the view passes a filter.
+             * Packed components share the group's positions, so their ticks are read without a lookup.
+             */
+            template <typename Filter>
+            b8 passes(auto* pool, b8 isPacked, u64 position) const noexcept {
+                if (isPacked) {
+                    return Filter::test(pool->getTicks()[position], since);
+                }
+                const u64 entity = indices[position];
+                return pool->contains(entity) && Filter::test(pool->getTicks(entity), since);
+            }
+
+            /**
+             * @brief Finds the first position at or after the given one that passes the filters.
+             * @param position The position to start from.
+             * @return The position found, or the size of the group if none.
+             */
+            u64 skip(u64 position) const noexcept {
+                if constexpr (filtering) {
+                    while (position < count && !accepts(position)) {
+                        position++;
+                    }
+                }
+                return position;
+            }
+
+            /**
+             * @brief Fetches a term for the entity at a position of the view, marking the component changed if fetched mutably.
+             * @tparam I The index of the term.
+             * @param position The position of the entity in the group, shared by every packed pool.
+             * @return A reference to the component, or a pointer that is null when an Optional component is missing.
+             */
+            template <std::size_t I>
+            decltype(auto) fetch(u64 position) const {
+                using Term = std::tuple_element_t<I, std::tuple<Fetches...>>;
+                using T = typename fetched<Term>::Type;
+                using Raw = component_t<Term>;
+                if (archetypal) {
+                    const Run& run = *locate(position);
+                    return take<I>(run, position - run.first);
+                }
+                Raw* data = std::get<I>(owned);
+                Component::Pool<Raw>* pool = std::get<I>(pools);
+                const u64 entity = indices[position];
+                if constexpr (fetched<Term>::optional) {
+                    if (!data && !pool->contains(entity)) {
+                        return static_cast<T*>(nullptr);
+                    }
+                }
+
+                if constexpr (!std::is_const_v<T>) {
+                    if (data) {
+                        pool->getTicks()[position].changed = now;
+                    } else {
+                        pool->markChanged(entity, now);
+                    }
+                }
+                T& component = data ? data[position] : pool->at(entity);
+                if constexpr (fetched<Term>::optional) {
+                    return &component;
                 } else {
-                    std::get<index>(owned) = nullptr;
-                    std::get<index>(pools) = pool;
+                    return component;
                 }
             }
 
-            std::tuple<remove_all_qualifiers_t<Components>*...> owned;
-            std::tuple<Component::Pool<remove_all_qualifiers_t<Components>>*...> pools;
-            const Entity* entities;
-            const u64 count;
+            template <std::size_t... I>
+            decltype(auto) tie(u64 position, std::index_sequence<I...>) const {
+                // Optional terms come back as pointers, which forward_as_tuple would leave dangling
+                return std::tuple<decltype(fetch<I>(position))...>(fetch<I>(position)...);
+            }
+
+            /**
+             * @brief Marks the mutable components at positions [first, last) of the view changed. Every component must be packed.
+             */
+            template <std::size_t... I>
+            void touch(u64 first, u64 last, std::index_sequence<I...>) const {
+                auto mark = [&](auto* pool) {
+                    std::for_each(pool->getTicks() + first, pool->getTicks() + last, [this](Component::Ticks& ticks) { ticks.changed = now; });
+                };
+                ((std::is_const_v<Fetches> ? void() : mark(std::get<I>(pools))), ...);
+            }
+
+            /**
+             * @brief Calls a function for the entities at positions [first, last) of the view that pass the filters.
+             * @tparam Function The type of the function.
+             * @tparam I The indices of the fetched terms.
+             * @param function The function to call.
+             * @param first The first position.
+             * @param last One past the last position.
+             */
+            template <typename Function, std::size_t... I>
+            void walk(Function& function, u64 first, u64 last, std::index_sequence<I...>) const {
+                if (archetypal) {
+                    for (auto run = first < last ? locate(first) : runs.end(); run != runs.end() && run->first < last; ++run) {
+                        const u64 end = std::min(last, run->first + run->size) - run->first;
+                        for (u64 row = std::max(first, run->first) - run->first; row < end; row++) {
+                            function(take<I>(*run, row)...);
+                        }
+                    }
+                    return;
+                }
+                for (u64 position = first; position < last; position++) {
+                    if constexpr (filtering) {
+                        if (!accepts(position)) continue;
+                    }
+                    function(fetch<I>(position)...);
+                }
+            }
         };
+
+        /**
+         * @brief Iterates over the entities of a system's group.
+         * @tparam Terms The component types to fetch, const for read-only access, mixed with Optional<T> components fetched
+         * as pointers and with the filters Added<T>, Changed<T> and Exclude<T...>. Fetching a component mutably marks it changed.
+         */
+        template <typename... Terms>
+        using View = BasicView<fetches_t<Terms...>, filters_t<Terms...>, excludes_t<Terms...>>;
     }  // namespace System
 }  // namespace rome::core
\ No newline at end of file
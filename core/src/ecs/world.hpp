@@ -1,6 +1,6 @@
 #pragma once
 
-#include "ecs/component/registry.hpp"
+#include "ecs/component/archetypes.hpp"
 #include "ecs/entity/registry.hpp"
 #include "ecs/event/registry.hpp"
 
@@ -8,11 +8,21 @@ namespace rome::core {
     namespace System {
         class Registry;
     }
+    namespace Command {
+        class Queue;
+    }
+    namespace Event {
+        class Bus;
+    }
 
     struct RM_API World {
-        System::Registry& systems;        ///< The registry for all systems in the ECS.
-        Component::Registry& components;  ///< The registry for all components in the ECS.
-        Entity::Registry& entities;       ///< The registry for all entities in the ECS.
-        Event::Registry& events;          ///< The registry for all events in the ECS.
+        System::Registry& systems;          ///< The registry for all systems in the ECS.
+        Component::Registry& components;    ///< The registry for all components in the ECS.
+        Component::Archetypes& archetypes;  ///< The archetype storage, used when the ECS runs on the archetype backend.
+        Entity::Registry& entities;         ///< The registry for all entities in the ECS.
+        Event::Registry& events;            ///< The registry for all events in the ECS.
+        Event::Bus& bus;                    ///< The event queues, swapped at the start of every update.
+        Command::Queue& commands;           ///< The structural changes deferred until the next sync point.
+        const b8 archetypal;                ///< Whether the components live in the archetype storage rather than in the pools.
     };
 }  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "memory/arena.hpp"
+
+#include "concurrency/thread.hpp"
+#include "debug/metrics.hpp"
+
+namespace rome::core {
+    namespace {
+        /**
+         * @brief A per-thread arena, with the thread its usage is reported against.
+         */
+        struct Registered {
+            FrameArena* arena;  ///< The arena.
+            UUID owner;         ///< The thread the arena belongs to.
+        };
+    }  // namespace
+
+    static std::mutex arenasLock;                     ///< Guards the arena registry.
+    static std::vector<Registered> arenas[2];         ///< Every live per-thread arena, by phase.
+    static thread_local Unique<FrameArena> local[2];  ///< The current thread's arenas, by phase.
+
+    FrameArena::FrameArena(u64 blockSize, std::pmr::memory_resource* upstream) : upstream(upstream), blockSize(blockSize) {}
+
+    FrameArena::~FrameArena() {
+        {
+            std::lock_guard guard(arenasLock);
+            for (std::vector<Registered>& registry : arenas) {
+                std::erase_if(registry, [this](const Registered& registered) { return registered.arena == this; });
+            }
+        }
+        for (const Block& block : blocks) {
+            upstream->deallocate(block.data, block.size);
+        }
+    }
+
+    FrameArena& FrameArena::get(Phase phase) {
+        Unique<FrameArena>& arena = local[static_cast<u8>(phase)];
+        if (!arena) {
+            arena = MakeUnique<FrameArena>();
+            std::lock_guard guard(arenasLock);
+            arenas[static_cast<u8>(phase)].push_back(Registered{arena.get(), ThreadInfo::getLocalID()});
+        }
+        return *arena;
+    }
+
+    u64 FrameArena::endFrame(Phase phase) {
+        u64 total = 0;
+        std::lock_guard guard(arenasLock);
+        for (const Registered& registered : arenas[static_cast<u8>(phase)]) {
+            total += registered.arena->getUsed();
+            Metrics::getInstance().registerArenaFrame(registered.owner, registered.arena->getUsed());
+            registered.arena->reset();
+        }
+        return total;
+    }
+
+    void FrameArena::reset() {
+        highWater = std::max(highWater, used);
+        if (current > 0) {
+            // The frame spilled over: trade the blocks for one that holds a whole frame
+            const u64 size = getCapacity();
+            for (const Block& block : blocks) {
+                upstream->deallocate(block.data, block.size);
+            }
+            blocks.clear();
+            blocks.push_back(Block{static_cast<std::byte*>(upstream->allocate(size)), size});
+        }
+        current = 0;
+        offset = 0;
+        used = 0;
+    }
+
+    u64 FrameArena::getCapacity() const noexcept {
+        u64 capacity = 0;
+        for (const Block& block : blocks) {
+            capacity += block.size;
+        }
+        return capacity;
+    }
+
+    void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+        while (current < blocks.size()) {
+            Block& block = blocks[current];
+            const u64 address = reinterpret_cast<u64>(block.data) + offset;
+            const u64 padding = (alignment - address % alignment) % alignment;
+            if (offset + padding + bytes <= block.size) {
+                offset += padding + bytes;
+                used += padding + bytes;
+                return block.data + offset - bytes;
+            }
+            // The rest of this block is wasted for the frame; reset() merges the blocks so it is not next time
+            used += block.size - offset;
+            current++;
+            offset = 0;
+        }
+
+        const u64 size = std::max<u64>(blockSize, bytes + alignment);
+        blocks.push_back(Block{static_cast<std::byte*>(upstream->allocate(size)), size});
+        current = blocks.size() - 1;
+        return do_allocate(bytes, alignment);
+    }
+
+    void FrameArena::do_deallocate(void*, size_t, size_t) {}
+
+    bool FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory_resource>
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief A linear allocator for scratch memory that only lives until the end of the current frame.
+     * Allocating bumps a pointer through blocks taken from an upstream resource; deallocating does nothing; reset()
+     * rewinds everything at once and keeps the blocks for the next frame. Use it with the std::pmr containers, e.g.
+     * std::pmr::vector<Entity> scratch(&FrameArena::get(FrameArena::Phase::Tick)).
+     * Every thread has its own arena per phase, so allocating never synchronizes. The strategies end the tick phase
+     * after every tick and the render phase after every frame, which resets the arenas of that phase on every thread.
+     * @warning Memory from a frame arena must not be used after its phase ends.
+     */
+    class RM_API FrameArena final : public std::pmr::memory_resource {
+        public:
+        /**
+         * @brief The part of the frame an arena lives for.
+         */
+        enum class Phase : u8 {
+            Tick,   ///< Reset after every tick.
+            Render  ///< Reset after every rendered frame.
+        };
+
+        static constexpr u64 DefaultBlockSize = 1 << 20;  ///< The default size of the blocks taken from upstream.
+
+        /**
+         * @brief Creates an arena.
+         * @param blockSize The size of the blocks taken from upstream (default is 1 MiB).
+         * @param upstream The resource the blocks come from (default is the global heap).
+         */
+        explicit FrameArena(u64 blockSize = DefaultBlockSize, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~FrameArena() override;
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+
+        /**
+         * @brief Gets the current thread's arena for a phase, creating it on first use.
+         * @param phase The phase the memory should live for.
+         * @return The arena.
+         */
+        static FrameArena& get(Phase phase);
+
+        /**
+         * @brief Ends a phase: resets every thread's arena for it and reports the bytes each used against its thread.
+         * @param phase The phase to end.
+         * @return The bytes used across every arena of the phase, summed over the threads.
+         * @warning No other thread may be allocating from an arena of this phase, e.g. no job may still be running.
+         */
+        static u64 endFrame(Phase phase);
+
+        /**
+         * @brief Releases every allocation at once, keeping the memory for reuse.
+         * If the last frame spilled over into several blocks, they are merged into a single one so the next frame fits.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the bytes handed out since the last reset, alignment padding included.
+         * @return The bytes used.
+         */
+        inline u64 getUsed() const noexcept { return used; }
+
+        /**
+         * @brief Gets the bytes held from upstream.
+         * @return The total size of the blocks.
+         */
+        u64 getCapacity() const noexcept;
+
+        /**
+         * @brief Gets the most bytes used within a single frame.
+         * @return The high-water mark.
+         */
+        inline u64 getHighWater() const noexcept { return std::max(highWater, used); }
+
+        private:
+        /**
+         * @brief A block of memory taken from upstream.
+         */
+        struct Block {
+            std::byte* data;  ///< The memory.
+            u64 size;         ///< The size of the memory.
+        };
+
+        std::pmr::memory_resource* upstream;  ///< Where the blocks come from.
+        u64 blockSize;                        ///< The size of new blocks.
+        std::vector<Block> blocks;            ///< The blocks, filled in order.
+        u64 current = 0;                      ///< The block being filled.
+        u64 offset = 0;                       ///< The first free byte of the current block.
+        u64 used = 0;                         ///< The bytes handed out since the last reset.
+        u64 highWater = 0;                    ///< The most bytes used by a finished frame.
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "memory/slab_pool.hpp"
+
+#include <bit>
+#include <unordered_map>
+
+namespace rome::core {
+    static std::mutex poolsLock;                      ///< Guards the pool registry.
+    static std::unordered_map<u64, SlabPool*> pools;  ///< Every live pool, by serial.
+
+    std::atomic<u64> SlabPool::nextSerial{0};
+    thread_local SlabPool::Bindings SlabPool::bound;
+
+    SlabPool::SlabPool(u64 slabSize, std::pmr::memory_resource* upstream)
+        : upstream(upstream), slabSize(std::bit_ceil(std::max<u64>(slabSize, MinBlockSize))), serial(nextSerial.fetch_add(1)) {
+        std::lock_guard guard(poolsLock);
+        pools.emplace(serial, this);
+    }
+
+    SlabPool::~SlabPool() {
+        {
+            // Exiting threads stop giving blocks back before the classes go away
+            std::lock_guard guard(poolsLock);
+            pools.erase(serial);
+        }
+        for (const Slab& slab : slabs) {
+            upstream->deallocate(slab.data, slab.size, slab.alignment);
+        }
+    }
+
+    u64 SlabPool::getSlabCount() const {
+        std::lock_guard guard(slabsLock);
+        return slabs.size();
+    }
+
+    u64 SlabPool::getReserved() const {
+        std::lock_guard guard(slabsLock);
+        u64 reserved = 0;
+        for (const Slab& slab : slabs) {
+            reserved += slab.size;
+        }
+        return reserved;
+    }
+
+    SlabPool::Bindings::~Bindings() {
+        for (const auto& [serial, cache] : caches) {
+            release(serial, *cache);
+        }
+    }
+
+    void SlabPool::release(u64 serial, Cache& cache) {
+        std::lock_guard guard(poolsLock);
+        // Serials are never reused, so a destroyed pool is simply missing, and its caches went away with it
+        auto it = pools.find(serial);
+        if (it != pools.end()) {
+            it->second->release(cache);
+        }
+    }
+
+    SlabPool::Cache& SlabPool::acquire() {
+        for (auto& [owner, cache] : bound.caches) {
+            if (owner == serial) {
+                return *cache;
+            }
+        }
+
+        Cache* local = nullptr;
+        {
+            // Take over a cache some thread gave back before growing the list
+            std::lock_guard guard(slabsLock);
+            auto it = std::ranges::find_if(caches, [](const Unique<Cache>& cache) { return !cache->bound; });
+            if (it == caches.end()) {
+                caches.push_back(MakeUnique<Cache>());
+                it = caches.end() - 1;
+            }
+            local = it->get();
+            local->bound = true;
+        }
+        if (bound.caches.size() >= MaxBound) {
+            // Give the evicted cache's blocks back, rather than stranding them until its pool is destroyed
+            release(bound.caches.front().first, *bound.caches.front().second);
+            bound.caches.erase(bound.caches.begin());
+        }
+        bound.caches.emplace_back(serial, local);
+        return *local;
+    }
+
+    void SlabPool::release(Cache& cache) {
+        for (u64 index = 0; index < ClassCount; index++) {
+            while (cache.free[index]) {
+                drain(cache, index);
+            }
+        }
+        std::lock_guard guard(slabsLock);
+        cache.bound = false;
+    }
+
+    void SlabPool::refill(Cache& cache, u64 index) {
+        const u64 size = MinBlockSize << index;
+        Class& sizeClass = classes[index];
+
+        std::lock_guard guard(sizeClass.lock);
+        for (u64 i = 0; i < getBatch(index); i++) {
+            Block* block = sizeClass.free;
+            if (block) {
+                sizeClass.free = block->next;
+            } else {
+                if (sizeClass.cursor == sizeClass.limit) {
+                    const u64 bytes = std::max(slabSize, size * 4);
+                    const u64 alignment = std::min(size, PageAlignment);
+                    sizeClass.cursor = static_cast<std::byte*>(upstream->allocate(bytes, alignment));
+                    sizeClass.limit = sizeClass.cursor + bytes;
+                    std::lock_guard slabsGuard(slabsLock);
+                    slabs.push_back(Slab{sizeClass.cursor, bytes, alignment});
+                }
+                block = reinterpret_cast<Block*>(sizeClass.cursor);
+                sizeClass.cursor += size;
+            }
+            block->next = cache.free[index];
+            cache.free[index] = block;
+            cache.count[index]++;
+        }
+    }
+
+    void SlabPool::drain(Cache& cache, u64 index) {
+        Class& sizeClass = classes[index];
+
+        std::lock_guard guard(sizeClass.lock);
+        for (u64 i = 0; i < getBatch(index) && cache.free[index]; i++) {
+            Block* block = cache.free[index];
+            cache.free[index] = block->next;
+            cache.count[index]--;
+            block->next = sizeClass.free;
+            sizeClass.free = block;
+        }
+    }
+
+    void* SlabPool::do_allocate(size_t bytes, size_t alignment) {
+        const u64 size = std::bit_ceil(std::max<u64>({bytes, alignment, MinBlockSize}));
+        if (size > MaxBlockSize || alignment > PageAlignment) {
+            return upstream->allocate(bytes, alignment);
+        }
+
+        const u64 index = std::countr_zero(size) - std::countr_zero(MinBlockSize);
+        Cache& cache = acquire();
+        if (!cache.free[index]) {
+            refill(cache, index);
+        }
+        Block* block = cache.free[index];
+        cache.free[index] = block->next;
+        cache.count[index]--;
+        return block;
+    }
+
+    void SlabPool::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+        const u64 size = std::bit_ceil(std::max<u64>({bytes, alignment, MinBlockSize}));
+        if (size > MaxBlockSize || alignment > PageAlignment) {
+            upstream->deallocate(ptr, bytes, alignment);
+            return;
+        }
+
+        const u64 index = std::countr_zero(size) - std::countr_zero(MinBlockSize);
+        Cache& cache = acquire();
+        Block* block = static_cast<Block*>(ptr);
+        block->next = cache.free[index];
+        cache.free[index] = block;
+        // Keep up to two batches so alternating allocate / deallocate at the edge does not bounce through the lock
+        if (++cache.count[index] >= 2 * getBatch(index)) {
+            drain(cache, index);
+        }
+    }
+
+    bool SlabPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+}  // namespace rome::core
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <atomic>
+#include <memory_resource>
+#include <mutex>
+
+#include "prelude.hpp"
+
+namespace rome::core {
+    /**
+     * @brief A general-purpose allocator serving power-of-two size classes out of fixed-size slabs.
+     * Each size class carves its blocks out of slabs taken from an upstream resource and recycles freed blocks through a
+     * free list, so storage that grows and shrinks all the time (component pools, event queues) stops round-tripping
+     * through the global heap. Every thread keeps a few free blocks per class, so most allocations never lock.
+     * Slabs are never moved nor given back upstream before the pool is destroyed, so a block keeps its address until it
+     * is deallocated. Requests larger than MaxBlockSize, or aligned past PageAlignment, go straight upstream.
+     * Use it with the std::pmr containers, e.g. Component::Registry::setResource(&pool).
+     * @warning The pool must outlive every allocation made from it.
+     */
+    class RM_API SlabPool final : public std::pmr::memory_resource {
+        public:
+        static constexpr u64 MinBlockSize = 16;          ///< The smallest size class.
+        static constexpr u64 MaxBlockSize = 1 << 18;     ///< The largest size class.
+        static constexpr u64 PageAlignment = 4096;       ///< The strictest alignment served from slabs.
+        static constexpr u64 DefaultSlabSize = 1 << 16;  ///< The default size of the slabs taken from upstream.
+
+        /**
+         * @brief Creates a pool.
+         * @param slabSize The size of the slabs taken from upstream, rounded up to a power of two (default is 64 KiB).
+         *                 Large classes use slabs of at least four blocks.
+         * @param upstream The resource the slabs come from (default is the global heap).
+         */
+        explicit SlabPool(u64 slabSize = DefaultSlabSize, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~SlabPool() override;
+        SlabPool(const SlabPool&) = delete;
+        SlabPool& operator=(const SlabPool&) = delete;
+        SlabPool(SlabPool&&) = delete;
+        SlabPool& operator=(SlabPool&&) = delete;
+
+        /**
+         * @brief Gets the number of slabs taken from upstream.
+         * @return The number of slabs.
+         * @note This function is thread-safe.
+         */
+        u64 getSlabCount() const;
+
+        /**
+         * @brief Gets the bytes held from upstream in slabs, excluding the requests that bypassed them.
+         * @return The total size of the slabs.
+         * @note This function is thread-safe.
+         */
+        u64 getReserved() const;
+
+        private:
+        static constexpr u64 ClassCount = 15;       ///< The number of size classes, MinBlockSize to MaxBlockSize.
+        static constexpr u64 CacheBytes = 1 << 15;  ///< The bytes a thread moves between its cache and a class at once.
+        static constexpr u64 MaxBatch = 64;         ///< The most blocks a thread moves between its cache and a class at once.
+        static constexpr u64 MaxBound = 16;         ///< The most pools a thread keeps a cache for.
+
+        /**
+         * @brief A free block, linked through its own memory.
+         */
+        struct Block {
+            Block* next;  ///< The next free block.
+        };
+
+        /**
+         * @brief The shared state of a size class.
+         */
+        struct Class {
+            std::mutex lock;              ///< Guards the class.
+            Block* free = nullptr;        ///< The blocks given back by the thread caches.
+            std::byte* cursor = nullptr;  ///< The first block of the current slab that was never handed out.
+            std::byte* limit = nullptr;   ///< The end of the current slab.
+        };
+
+        /**
+         * @brief The free blocks a thread keeps for itself, by size class.
+         */
+        struct Cache {
+            Block* free[ClassCount] = {};  ///< The free blocks.
+            u64 count[ClassCount] = {};    ///< The number of free blocks.
+            b8 bound = false;              ///< Whether a thread uses the cache.
+        };
+
+        /**
+         * @brief The current thread's caches, which give their blocks back to their pools when the thread exits.
+         */
+        struct Bindings {
+            std::vector<std::pair<u64, Cache*>> caches;  ///< The caches, by pool serial.
+
+            ~Bindings();
+        };
+
+        /**
+         * @brief A slab taken from upstream.
+         */
+        struct Slab {
+            std::byte* data;  ///< The memory.
+            u64 size;         ///< The size of the memory.
+            u64 alignment;    ///< The alignment the memory was requested with.
+        };
+
+        static std::atomic<u64> nextSerial;   ///< The serial of the next pool.
+        static thread_local Bindings bound;   ///< The current thread's caches.
+        std::pmr::memory_resource* upstream;  ///< Where the slabs come from.
+        u64 slabSize;                         ///< The minimum size of new slabs.
+        u64 serial;                           ///< Identifies the pool in the thread caches.
+        Class classes[ClassCount];            ///< The size classes.
+        mutable std::mutex slabsLock;         ///< Guards the slabs and the caches.
+        std::vector<Slab> slabs;              ///< Every slab, in allocation order.
+        std::vector<Unique<Cache>> caches;    ///< Every thread cache of this pool.
+
+        /**
+         * @brief Gets the number of blocks moved between a thread cache and a size class at once.
+         * @param index The size class.
+         * @return The batch size.
+         */
+        static constexpr u64 getBatch(u64 index) noexcept { return std::clamp<u64>(CacheBytes / (MinBlockSize << index), 1, MaxBatch); }
+
+        /**
+         * @brief Gets the current thread's cache, binding one on first use.
+         * Caches given back by exiting threads, or evicted from a thread's bindings, are reused before a new one is made.
+         * @return The current thread's cache.
+         */
+        Cache& acquire();
+
+        /**
+         * @brief Gives every block of a cache back to the size classes and unbinds the cache, so another thread can reuse it.
+         * @param cache The thread cache.
+         */
+        void release(Cache& cache);
+
+        /**
+         * @brief Releases a cache of the pool with the given serial, if that pool is still alive.
+         * @param serial The serial of the pool.
+         * @param cache The thread cache.
+         */
+        static void release(u64 serial, Cache& cache);
+
+        /**
+         * @brief Moves a batch of blocks from a size class into a thread cache, carving a new slab if needed.
+         * @param cache The thread cache.
+         * @param index The size class.
+         */
+        void refill(Cache& cache, u64 index);
+
+        /**
+         * @brief Moves a batch of blocks from a thread cache back to its size class.
+         * @param cache The thread cache.
+         * @param index The size class.
+         */
+        void drain(Cache& cache, u64 index);
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+}  // namespace rome::core
\ No newline at end of file
@@ -103,6 +103,13 @@ namespace rome::core {
          */
         u64 timeNS();
 
+        /**
+         * @brief Sleeps the calling thread until an absolute time on the timeNS() clock.
+         * @param deadline The time to wake up at in nanoseconds.
+         * @note The thread may wake late by the OS timer slack, but never early.
+         */
+        void sleepUntilNS(u64 deadline);
+
         /**
          * @brief Generates a random 64-bit unsigned integer.
          * @return The random u64.
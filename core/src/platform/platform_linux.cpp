@@ -2,7 +2,9 @@
 
 #ifdef RM_LINUX
 
+#include <errno.h>
 #include <fcntl.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <chrono>
@@ -173,6 +175,12 @@ namespace rome::core {
 
     u64 Platform::timeNS() { return std::chrono::duration_cast<std::chrono::nanoseconds>(clock.now().time_since_epoch()).count(); }
 
+    void Platform::sleepUntilNS(u64 deadline) {
+        // steady_clock is CLOCK_MONOTONIC, so the deadline can be handed to the kernel as is
+        timespec time{static_cast<time_t>(deadline / 1000000000), static_cast<long>(deadline % 1000000000)};
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR) {}
+    }
+
     u64 Platform::randomU64() {
         static int fd = []() -> int {
             int fileDesc = open("/dev/urandom", O_RDONLY);
@@ -5,6 +5,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <thread>
+
 #include "debug/log.hpp"
 
 namespace rome::core {
@@ -171,6 +173,10 @@ namespace rome::core {
 
     u64 Platform::timeNS() { return std::chrono::duration_cast<std::chrono::nanoseconds>(clock.now().time_since_epoch()).count(); }
 
+    void Platform::sleepUntilNS(u64 deadline) {
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(deadline)));
+    }
+
     u64 Platform::randomU64() {
         static int fd = []() -> int {
             int fileDesc = open("/dev/urandom", O_RDONLY);
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include "app/app.hpp"
+#include "platform/platform.hpp"
+
+using namespace rome::core;
+
+namespace {
+    /**
+     * @brief An application recording its ticks. Rendering it is a failure.
+     */
+    class HeadlessApp : public Application {
+        public:
+        std::vector<rome::f64> steps;  ///< Every tick's dt.
+        rome::b8 rendered = false;     ///< Whether render was ever called.
+
+        explicit HeadlessApp(const Config& config) : Application(config) {}
+
+        void setup() override {}
+        void shutdown() override {}
+        void tick(rome::f64 dt) override { steps.push_back(dt); }
+        void render(rome::f64) override { rendered = true; }
+    };
+}  // namespace
+
+/**
+ * @brief Tests that fast-forwarding runs far quicker than the tick rate with the same fixed dt.
+ */
+TEST(HeadlessStrategyTest, FastForwardsWithFixedStep) {
+    HeadlessApp app(Application::Builder().setTickRate(60).enableHeadless(true).setTickLimit(1000).build());
+    const rome::u64 begin = Platform::getInstance().timeNS();
+    app.start();
+
+    // 1000 ticks at 60 Hz would take over 16 seconds if paced
+    EXPECT_LT(Platform::getInstance().timeNS() - begin, 5000000000u);
+    ASSERT_EQ(app.steps.size(), 1000u);
+    for (rome::f64 dt : app.steps) {
+        EXPECT_EQ(dt, 1.0 / 60);
+    }
+    EXPECT_FALSE(app.rendered);
+}
+
+/**
+ * @brief Tests that a paced headless run keeps to the tick rate.
+ */
+TEST(HeadlessStrategyTest, PacesToTickRate) {
+    HeadlessApp app(Application::Builder().setTickRate(200).enableHeadless().setTickLimit(20).build());
+    const rome::u64 begin = Platform::getInstance().timeNS();
+    app.start();
+
+    EXPECT_GE(Platform::getInstance().timeNS() - begin, 100000000u);
+    EXPECT_EQ(app.steps.size(), 20u);
+    EXPECT_FALSE(app.rendered);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+
+#include "app/snapshot.hpp"
+
+using namespace rome::core;
+
+namespace {
+    /**
+     * @brief A simulation of a single counter, rendered from snapshots.
+     */
+    class CounterApp : public SnapshotApplication<rome::u64> {
+        public:
+        rome::u64 counter = 0;                   ///< The live simulation state. Tick thread only.
+        std::atomic<rome::b8> consistent{true};  ///< Whether every frame saw two consecutive ticks.
+        std::atomic<rome::u64> rendered{0};      ///< The latest tick count rendered.
+
+        CounterApp() : SnapshotApplication(Application::Builder().setTickRate(500).setRenderRate(500).build()) {}
+
+        void setup() override {}
+        void shutdown() override {}
+
+        void tick(rome::f64) override {
+            if (++counter == 50) stop();
+        }
+
+        protected:
+        void capture(rome::u64& state) override { state = counter; }
+
+        void render(rome::f64, rome::f64, const rome::u64& previous, const rome::u64& latest) override {
+            if (latest != 0 && (previous + 1 != latest || getSnapshotGeneration() != latest)) consistent = false;
+            rendered = latest;
+        }
+    };
+}  // namespace
+
+/**
+ * @brief Tests that frames always render a pair of consecutive ticks.
+ */
+TEST(SnapshotApplicationTest, RendersConsecutiveTicks) {
+    CounterApp app;
+    app.start();
+    EXPECT_TRUE(app.consistent.load());
+    EXPECT_GT(app.rendered.load(), 0u);
+}
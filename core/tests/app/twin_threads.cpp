@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "app/app.hpp"
+#include "platform/platform.hpp"
+
+using namespace rome::core;
+
+namespace {
+    /**
+     * @brief An application recording what the strategy hands to tick and render, stopping after a number of ticks.
+     */
+    class RecordingApp : public Application {
+        public:
+        std::vector<rome::f64> steps;              ///< Every tick's dt.
+        std::atomic<rome::u64> frames{0};          ///< The number of interpolated frames.
+        std::atomic<rome::b8> alphaInRange{true};  ///< Whether every alpha was within [0, 1].
+        rome::u64 stallAt = 0;                     ///< The tick to stall on, 0 for none.
+        rome::u64 stopAt;                          ///< The tick to stop after.
+
+        RecordingApp(const Config& config, rome::u64 stopAt) : Application(config), stopAt(stopAt) {}
+
+        void setup() override {}
+        void shutdown() override {}
+
+        void tick(rome::f64 dt) override {
+            steps.push_back(dt);
+            if (steps.size() == stallAt) std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            if (steps.size() == stopAt) stop();
+        }
+
+        void render(rome::f64) override {}
+
+        void render(rome::f64, rome::f64 alpha) override {
+            if (alpha < 0.0 || alpha > 1.0) alphaInRange = false;
+            frames++;
+        }
+    };
+}  // namespace
+
+/**
+ * @brief Tests that ticks always get the fixed step and frames an interpolation factor within [0, 1].
+ */
+TEST(TwinStrategyTest, TicksAtFixedStep) {
+    RecordingApp app(Application::Builder().setTickRate(200).setRenderRate(400).build(), 20);
+    app.start();
+
+    ASSERT_EQ(app.steps.size(), 20u);
+    for (rome::f64 dt : app.steps) {
+        EXPECT_EQ(dt, 1.0 / 200);
+    }
+    EXPECT_GT(app.frames.load(), 0u);
+    EXPECT_TRUE(app.alphaInRange.load());
+}
+
+/**
+ * @brief Tests that a stalled tick is followed by at most the capped number of catch-up ticks, not a burst.
+ */
+TEST(TwinStrategyTest, CapsCatchUpTicks) {
+    RecordingApp app(Application::Builder().setTickRate(100).setRenderRate(100).setMaxCatchUpTicks(1).build(), 6);
+    app.stallAt = 1;
+    const rome::u64 begin = Platform::getInstance().timeNS();
+    app.start();
+
+    // Without the cap the 200ms stall would be paid back by an immediate burst of the 5 remaining ticks
+    EXPECT_GE(Platform::getInstance().timeNS() - begin, 240000000u);
+}
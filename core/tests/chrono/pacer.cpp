@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "chrono/pacer.hpp"
+
+using namespace rome::core;
+
+/**
+ * @brief Tests that a hybrid pacer holds its rate while mostly sleeping.
+ */
+TEST(FramePacerTest, HybridHoldsRate) {
+    FramePacer pacer(200.0);
+    pacer.start();
+    rome::f64 total = 0.0;
+    for (int i = 0; i < 40; i++) {
+        total += pacer.wait();
+    }
+
+    const FramePacer::Stats stats = pacer.getStats();
+    EXPECT_GE(total, 0.2);
+    EXPECT_LT(total, 0.3);
+    EXPECT_EQ(stats.frames, 40u);
+    EXPECT_GT(stats.sleepTime, stats.spinTime);
+    EXPECT_GE(stats.slack, FramePacer::MinSlackNS / 1e9);
+    EXPECT_LE(stats.meanJitter, stats.maxJitter);
+}
+
+/**
+ * @brief Tests that spinning never sleeps and sleeping never spins past the deadline.
+ */
+TEST(FramePacerTest, ModesTradeSleepForSpin) {
+    FramePacer spin(500.0, FramePacer::Mode::Spin);
+    spin.start();
+    for (int i = 0; i < 10; i++) spin.wait();
+    EXPECT_EQ(spin.getStats().sleepTime, 0.0);
+    EXPECT_GT(spin.getStats().spinTime, 0.0);
+
+    FramePacer sleep(500.0, FramePacer::Mode::Sleep);
+    sleep.start();
+    for (int i = 0; i < 10; i++) sleep.wait();
+    EXPECT_GT(sleep.getStats().sleepTime, 0.0);
+    EXPECT_LT(sleep.getStats().spinTime, sleep.getStats().sleepTime);
+}
+
+/**
+ * @brief Tests that a pacer left behind resyncs instead of returning immediately for every missed deadline.
+ */
+TEST(FramePacerTest, ResyncsAfterStall) {
+    FramePacer pacer(1000.0);
+    pacer.start();
+    pacer.wait();
+    // A loaded machine may miss the first deadline too, so only count the miss the stall causes
+    const rome::u64 missed = pacer.getStats().missed;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_GE(pacer.wait(), 0.02);
+    EXPECT_EQ(pacer.getStats().missed - missed, 1u);
+    EXPECT_GE(pacer.wait(), 0.0009);
+
+    pacer.resetStats();
+    EXPECT_EQ(pacer.getStats().frames, 0u);
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <set>
+
+#include "concurrency/jobs.hpp"
+
+using namespace rome::core;
+
+/**
+ * @brief Tests LIFO pops, FIFO steals and growth on a single thread.
+ */
+TEST(WorkStealingDequeTest, PopStealAndGrow) {
+    WorkStealingDeque<rome::u64> deque(4);
+    for (rome::u64 i = 0; i < 10; i++) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.getSize(), 10u);
+    EXPECT_GE(deque.getCapacity(), 16u);
+
+    rome::u64 item;
+    ASSERT_TRUE(deque.pop(item));
+    EXPECT_EQ(item, 9u);
+    ASSERT_TRUE(deque.steal(item));
+    EXPECT_EQ(item, 0u);
+    while (deque.pop(item)) {
+    }
+    EXPECT_EQ(deque.getSize(), 0u);
+    EXPECT_FALSE(deque.steal(item));
+}
+
+/**
+ * @brief Tests that every pushed item is taken exactly once while thieves race the owner.
+ */
+TEST(WorkStealingDequeTest, ConcurrentStealsTakeEachItemOnce) {
+    constexpr rome::u64 count = 100000;
+    WorkStealingDeque<rome::u64> deque(8);
+    std::vector<std::atomic<rome::u32>> taken(count);
+    std::atomic<rome::b8> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++) {
+        thieves.emplace_back([&]() {
+            rome::u64 item;
+            while (!done.load() || deque.getSize() > 0) {
+                if (deque.steal(item)) taken[item]++;
+            }
+        });
+    }
+
+    rome::u64 item;
+    for (rome::u64 i = 0; i < count; i++) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(item)) taken[item]++;
+    }
+    while (deque.pop(item)) {
+        taken[item]++;
+    }
+    done.store(true);
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    for (rome::u64 i = 0; i < count; i++) {
+        ASSERT_EQ(taken[i].load(), 1u) << "item " << i;
+    }
+}
+
+/**
+ * @brief Tests that a counter tracks submitted jobs and that jobs run on aliased workers.
+ */
+TEST(JobSystemTest, CounterWaitsForEveryJob) {
+    JobSystem jobs(3, "Test Worker");
+    JobSystem::Counter counter;
+    std::atomic<int> sum{0};
+    std::mutex aliasesLock;
+    std::set<std::string> aliases;
+
+    for (int i = 1; i <= 1000; i++) {
+        jobs.submit(
+            [&, i]() {
+                sum += i;
+                std::lock_guard guard(aliasesLock);
+                aliases.insert(ThreadInfo::getLocalAlias());
+            },
+            &counter);
+    }
+    jobs.wait(counter);
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(sum.load(), 500500);
+    for (const std::string& alias : aliases) {
+        EXPECT_TRUE(alias == "Main" || alias.starts_with("Test Worker ")) << alias;
+    }
+}
+
+/**
+ * @brief Tests that a job submitted after a counter only starts once the counter's jobs are done.
+ */
+TEST(JobSystemTest, DependenciesRunInOrder) {
+    JobSystem jobs(4);
+    JobSystem::Counter first;
+    JobSystem::Counter second;
+    std::atomic<int> finished{0};
+    std::atomic<int> seen{-1};
+
+    for (int i = 0; i < 64; i++) {
+        jobs.submit([&]() { finished++; }, &first);
+    }
+    jobs.submit([&]() { seen = finished.load(); }, &second, &first);
+    jobs.wait(second);
+    EXPECT_EQ(seen.load(), 64);
+}
+
+/**
+ * @brief Tests that wait() rethrows the first failure of its jobs once they all finished, whatever they threw.
+ */
+TEST(JobSystemTest, WaitRethrowsJobFailures) {
+    JobSystem jobs(3);
+    JobSystem::Counter counter;
+    std::atomic<int> finished{0};
+    for (int i = 0; i < 100; i++) {
+        jobs.submit(
+            [&finished, i]() {
+                if (i == 50) throw 42;
+                finished++;
+            },
+            &counter);
+    }
+    EXPECT_THROW(jobs.wait(counter), int);
+    EXPECT_TRUE(counter.isDone());
+    EXPECT_EQ(finished.load(), 99);
+    EXPECT_NO_THROW(jobs.wait(counter));
+
+    EXPECT_THROW(jobs.parallelFor(
+                     0, 100,
+                     [](rome::u64 first, rome::u64) {
+                         if (first == 90) throw std::runtime_error("batch failed");
+                     },
+                     10),
+                 std::runtime_error);
+}
+
+/**
+ * @brief Tests that parallelFor covers a range exactly once, including from inside a job with a single worker.
+ */
+TEST(JobSystemTest, ParallelForCoversRange) {
+    JobSystem jobs(1);
+    std::vector<int> hits(10007, 0);
+    jobs.parallelFor(0, hits.size(), [&](rome::u64 first, rome::u64 last) {
+        for (rome::u64 i = first; i < last; i++) hits[i]++;
+    });
+    EXPECT_TRUE(std::ranges::all_of(hits, [](int hit) { return hit == 1; }));
+
+    // The only worker waits on nested batches, so it must run them itself instead of blocking
+    JobSystem::Counter outer;
+    std::atomic<rome::u64> total{0};
+    jobs.submit(
+        [&]() {
+            jobs.parallelFor(
+                0, 1000,
+                [&](rome::u64 first, rome::u64 last) {
+                    for (rome::u64 i = first; i < last; i++) total += i;
+                },
+                7);
+        },
+        &outer);
+    jobs.wait(outer);
+    EXPECT_EQ(total.load(), 499500u);
+}
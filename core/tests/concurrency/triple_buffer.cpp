@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "concurrency/thread.hpp"
+#include "concurrency/triple_buffer.hpp"
+
+using namespace rome::core;
+
+namespace {
+    /**
+     * @brief A value that is only consistent if written in full.
+     */
+    struct Pair {
+        rome::u64 a = 0;
+        rome::u64 b = 0;
+    };
+}  // namespace
+
+/**
+ * @brief Tests that the reader sees the initial value, then only the latest publication.
+ */
+TEST(TripleBufferTest, ReadsLatestPublication) {
+    TripleBuffer<int> buffer(-1);
+    EXPECT_FALSE(buffer.isUpdated());
+    EXPECT_EQ(buffer.read(), -1);
+    EXPECT_EQ(buffer.getGeneration(), 0u);
+
+    buffer.write() = 1;
+    buffer.publish();
+    buffer.write() = 2;
+    buffer.publish();
+    EXPECT_TRUE(buffer.isUpdated());
+    EXPECT_EQ(buffer.read(), 2);
+    EXPECT_EQ(buffer.getGeneration(), 2u);
+
+    // Nothing new: the same value stays readable
+    EXPECT_FALSE(buffer.isUpdated());
+    EXPECT_EQ(buffer.read(), 2);
+
+    buffer.write() = 3;
+    buffer.publish();
+    EXPECT_EQ(buffer.read(), 3);
+    EXPECT_EQ(buffer.getGeneration(), 3u);
+}
+
+/**
+ * @brief Tests that a concurrent reader never sees a torn value or goes back in time.
+ */
+TEST(TripleBufferTest, NeverTears) {
+    TripleBuffer<Pair> buffer;
+    constexpr rome::u64 Count = 200000;
+
+    Thread writer("Triple Buffer Writer");
+    writer.run([&buffer]() {
+        for (rome::u64 i = 1; i <= Count; i++) {
+            Pair& pair = buffer.write();
+            pair.a = i;
+            pair.b = i * 2;
+            buffer.publish();
+        }
+    });
+
+    rome::u64 last = 0;
+    while (last < Count) {
+        const Pair& pair = buffer.read();
+        ASSERT_EQ(pair.b, pair.a * 2);
+        ASSERT_GE(pair.a, last);
+        ASSERT_EQ(buffer.getGeneration(), pair.a);
+        last = pair.a;
+    }
+    writer.join();
+}
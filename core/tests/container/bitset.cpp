@@ -127,4 +127,34 @@ constexpr rome::u64 BigId = InlineBits + 123;  // forces spill resize
 BITSET_TESTS(u8)
 BITSET_TESTS(u16)
 BITSET_TESTS(u32)
-BITSET_TESTS(u64)
\ No newline at end of file
+BITSET_TESTS(u64)
+
+TEST(BitSetFunctionalityTest, IncludesAcrossSizes) {
+    BitSet<rome::u32, 64> signature{1, 5, 70};
+    EXPECT_TRUE((signature.includes(BitSet<rome::u32, 64>{1, 70})));
+    EXPECT_TRUE((signature.includes(BitSet<rome::u32, 64>{})));
+    EXPECT_FALSE((signature.includes(BitSet<rome::u32, 64>{1, 2})));
+    EXPECT_FALSE((signature.includes(BitSet<rome::u32, 64>{1, 200})));
+    EXPECT_FALSE((BitSet<rome::u32, 64>{1}.includes(signature)));
+    // Bits past the storage read as unset instead of running off the end
+    EXPECT_FALSE(signature.test(500));
+}
+
+TEST(BitSetFunctionalityTest, EachVisitsSetBitsInOrder) {
+    BitSet<rome::u32, 64> signature{70, 0, 63, 5};
+    std::vector<rome::u32> bits;
+    signature.each([&](rome::u32 bit) { bits.push_back(bit); });
+    EXPECT_EQ(bits, (std::vector<rome::u32>{0, 5, 63, 70}));
+}
+
+TEST(BitSetFunctionalityTest, IntersectsAcrossSizes) {
+    // 70 spills past the inline words, so the two bitsets have a different word count
+    BitSet<rome::u32, 64> spilled{3, 70};
+    BitSet<rome::u32, 64> direct{3};
+    EXPECT_TRUE(spilled.intersects(direct));
+    EXPECT_TRUE(direct.intersects(spilled));
+    EXPECT_FALSE((spilled.intersects(BitSet<rome::u32, 64>{4})));
+    EXPECT_FALSE((BitSet<rome::u32, 64>{4}.intersects(spilled)));
+    EXPECT_TRUE((spilled.intersects(BitSet<rome::u32, 64>{70})));
+    EXPECT_FALSE((spilled.intersects(BitSet<rome::u32, 64>{200})));
+}
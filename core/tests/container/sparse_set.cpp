@@ -254,3 +254,90 @@ TEST(SparseSetFunctionalityTest, SwapOnlyAffectsRawBuffer) {
     EXPECT_EQ(set.at(1), 10);
     EXPECT_EQ(set.at(2), 20);
 }
+
+/**
+ * @brief Tests that a single high index only allocates the sparse page it lives in.
+ */
+TEST(SparseSetPagingTest, HighIndexAllocatesSinglePage) {
+    SparseSet<int> set;
+    const rome::u64 high = 1ull << 32;
+    set.insert(high, 42);
+
+    EXPECT_TRUE(set.contains(high));
+    EXPECT_FALSE(set.contains(high - 1));
+    EXPECT_FALSE(set.contains(0));
+    EXPECT_EQ(set.at(high), 42);
+    EXPECT_EQ(set.getPageCount(), 1u);
+
+    // A flat sparse array would need 8 bytes for every index below high (~32 GiB)
+    EXPECT_LT(set.getMemoryUsage(), 64ull * 1024 * 1024);
+}
+
+/**
+ * @brief Tests that pages are released once every element mapped through them is erased.
+ */
+TEST(SparseSetPagingTest, ErasingReleasesPages) {
+    SparseSet<int, rome::u64, 64> set;
+    for (rome::u64 i = 0; i < 256; i++) {
+        set.insert(i, static_cast<int>(i));
+    }
+    EXPECT_EQ(set.getPageCount(), 4u);
+    const rome::u64 full = set.getMemoryUsage();
+
+    for (rome::u64 i = 64; i < 128; i++) {
+        set.erase(i);
+    }
+    EXPECT_EQ(set.getPageCount(), 3u);
+    EXPECT_LT(set.getMemoryUsage(), full);
+
+    // Remaining elements are still reachable, including the ones moved by swap-and-pop
+    for (rome::u64 i = 0; i < 256; i++) {
+        if (i >= 64 && i < 128) {
+            EXPECT_FALSE(set.contains(i));
+        } else {
+            EXPECT_EQ(set.at(i), static_cast<int>(i));
+        }
+    }
+
+    // The released page is allocated again on demand
+    set.insert(100, 7);
+    EXPECT_EQ(set.getPageCount(), 4u);
+    EXPECT_EQ(set.at(100), 7);
+}
+
+/**
+ * @brief Tests that 32-bit dense indices halve the sparse footprint without changing behaviour.
+ */
+TEST(SparseSetPagingTest, CompactIndexUsesLessMemory) {
+    SparseSet<char> wide;
+    SparseSet<char, rome::u32> compact;
+    for (rome::u64 i = 0; i < 100000; i += 1000) {
+        wide.insert(i, 'w');
+        compact.insert(i, 'c');
+    }
+
+    EXPECT_EQ(wide.getSize(), compact.getSize());
+    EXPECT_EQ(wide.getPageCount(), compact.getPageCount());
+    EXPECT_LT(compact.getMemoryUsage(), wide.getMemoryUsage());
+
+    compact.swap(0, 99000);
+    EXPECT_EQ(compact.at(0), 'c');
+    compact.erase(0);
+    EXPECT_FALSE(compact.contains(0));
+    EXPECT_TRUE(compact.contains(99000));
+}
+
+/**
+ * @brief Tests that copies own their pages independently of the source.
+ */
+TEST(SparseSetPagingTest, CopyIsDeep) {
+    SparseSet<int> set;
+    set.insert(5000, 1);
+
+    SparseSet<int> copy(set);
+    set.erase(5000);
+
+    EXPECT_FALSE(set.contains(5000));
+    EXPECT_TRUE(copy.contains(5000));
+    EXPECT_EQ(copy.at(5000), 1);
+}
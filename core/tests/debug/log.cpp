@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <cstdio>
+
+#include "concurrency/thread.hpp"
+#include "debug/log.hpp"
+
+using namespace rome::core;
+
+/**
+ * @brief Captures the logger output in a temporary file.
+ */
+class LogTest : public ::testing::Test {
+    protected:
+    std::FILE* file = nullptr;
+
+    void SetUp() override {
+        file = std::tmpfile();
+        ASSERT_NE(file, nullptr);
+        Logger::getInstance().setOutput(file);
+    }
+
+    void TearDown() override {
+        Logger::getInstance().stop();
+        Logger::getInstance().setOutput(stdout);
+        std::fclose(file);
+    }
+
+    /**
+     * @brief Reads and clears everything written so far.
+     */
+    std::string take() {
+        Logger::getInstance().flush();
+        std::string contents(static_cast<size_t>(std::ftell(file)), '\0');
+        std::rewind(file);
+        contents.resize(std::fread(contents.data(), 1, contents.size(), file));
+        std::fclose(file);
+        file = std::tmpfile();
+        Logger::getInstance().setOutput(file);
+        return contents;
+    }
+
+    /**
+     * @brief Logs a message exercising every kind of conversion.
+     */
+    static void logEverything() {
+        const std::string longText(1000, 'x');
+        const char* missing = nullptr;
+        RM_INFO("plain message with 100%% literal text");
+        RM_WARN("%d %5.2f %-8s| %c %x %llu %zu %p %s", -42, 3.14159, "left", 'z', 255u, ULLONG_MAX, sizeof(double),
+                reinterpret_cast<void*>(0x1234), missing);
+        RM_ERROR("%*d|%.*s|%.3s|%Lf|%hhd", 6, 7, 2, "truncated", "abcdef", 1.5L, 300);
+        RM_INFO("too long to capture: %s", longText.c_str());
+        RM_FATAL("%s, line %d", "fatal", 12);
+    }
+};
+
+/**
+ * @brief Tests that asynchronous mode writes exactly what synchronous mode writes.
+ */
+TEST_F(LogTest, AsyncMatchesSync) {
+    logEverything();
+    const std::string expected = take();
+    EXPECT_NE(expected.find("\x1b[38;5;208m[WARN]:  \x1b[39m-42  3.14 left    | z ff 18446744073709551615 8"), std::string::npos);
+
+    Logger::getInstance().start();
+    ASSERT_TRUE(Logger::getInstance().isAsync());
+    logEverything();
+    EXPECT_EQ(take(), expected);
+}
+
+/**
+ * @brief Tests that asynchronous mode copies formats that die with the call, short or too long to fit a record.
+ */
+TEST_F(LogTest, AsyncCopiesTemporaryFormats) {
+    Logger::getInstance().start();
+    for (int i = 0; i < 100; i++) {
+        std::string format = "temporary format " + std::to_string(i) + " %d";
+        logMessage(LogLevel::Info, format.c_str(), i);
+        format.assign(format.size(), '#');
+    }
+    std::string longFormat = std::string(300, 'y') + " %d";
+    logMessage(LogLevel::Info, longFormat.c_str(), 7);
+    longFormat.assign(longFormat.size(), '#');
+
+    const std::string written = take();
+    EXPECT_EQ(written.find('#'), std::string::npos);
+    for (int i = 0; i < 100; i++) {
+        const std::string line = "temporary format " + std::to_string(i) + " " + std::to_string(i) + "\n";
+        EXPECT_NE(written.find(line), std::string::npos) << line;
+    }
+    EXPECT_NE(written.find(std::string(300, 'y') + " 7\n"), std::string::npos);
+}
+
+/**
+ * @brief Tests that messages from several threads are all written, each thread's in order.
+ */
+TEST_F(LogTest, KeepsPerThreadOrder) {
+    const rome::u64 dropped = Logger::getInstance().getDropped();
+    Logger::getInstance().start(Logger::Policy::Block, 4);
+    std::vector<Thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back("Log Test");
+        threads.back().run([t]() {
+            for (int i = 0; i < 200; i++) {
+                RM_INFO("%d:%d", t, i);
+            }
+        });
+    }
+    for (Thread& thread : threads) thread.join();
+
+    const std::string output = take();
+    for (int t = 0; t < 4; t++) {
+        size_t at = 0;
+        for (int i = 0; i < 200; i++) {
+            at = output.find("\x1b[39m" + std::to_string(t) + ":" + std::to_string(i) + "\n", at);
+            ASSERT_NE(at, std::string::npos) << t << ":" << i;
+        }
+    }
+    EXPECT_EQ(Logger::getInstance().getDropped(), dropped);
+}
+
+/**
+ * @brief Tests that the drop policy accounts for every message it does not write.
+ */
+TEST_F(LogTest, DropsWhenFull) {
+    const rome::u64 before = Logger::getInstance().getDropped();
+    Logger::getInstance().start(Logger::Policy::Drop, 2);
+    Thread thread("Log Drop Test");
+    thread.run([]() {
+        for (int i = 0; i < 1000; i++) {
+            RM_INFO("message %d", i);
+        }
+    });
+    thread.join();
+
+    const std::string output = take();
+    const rome::u64 lines = std::count(output.begin(), output.end(), '\n');
+    EXPECT_EQ(lines + Logger::getInstance().getDropped() - before, 1000u);
+}
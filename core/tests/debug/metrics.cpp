@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include "concurrency/thread.hpp"
+#include "debug/metrics.hpp"
+
+using namespace rome::core;
+
+/**
+ * @brief Tests that a tracking thread accounts for its own allocations and frees without a pointer map.
+ */
+TEST(MetricsTest, TracksThreadLocalAllocations) {
+    Metrics& metrics = Metrics::getInstance();
+    metrics.start();
+
+    Thread thread("Metrics Test");
+    thread.run([&metrics]() {
+        metrics.registerThread("Metrics Test");
+        metrics.setIsMemoryTracking(true);
+
+        char* block = new char[1000];
+        block[0] = 1;
+        EXPECT_EQ(metrics.getTotalAllocations(), 1u);
+        EXPECT_GE(metrics.getTotalBytes(), 1000u);
+        EXPECT_GE(metrics.getCurrentBytes(), 1000u);
+        EXPECT_EQ(metrics.getMissingDeallocations(), 1u);
+
+        delete[] block;
+        EXPECT_EQ(metrics.getCurrentBytes(), 0u);
+        EXPECT_EQ(metrics.getMissingDeallocations(), 0u);
+        EXPECT_GE(metrics.getPeakBytes(), 1000u);
+
+        // Nothing is accounted once tracking is off
+        metrics.setIsMemoryTracking(false);
+        delete new int(7);
+        EXPECT_EQ(metrics.getTotalAllocations(), 1u);
+        metrics.unregisterThread();
+    });
+    thread.join();
+
+    metrics.stop();
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "concurrency/thread.hpp"
+#include "debug/profiler.hpp"
+
+using namespace rome::core;
+
+namespace {
+    /**
+     * @brief Counts the occurrences of a substring.
+     */
+    rome::u64 count(const std::string& haystack, const std::string& needle) {
+        rome::u64 occurrences = 0;
+        for (size_t at = haystack.find(needle); at != std::string::npos; at = haystack.find(needle, at + 1)) {
+            occurrences++;
+        }
+        return occurrences;
+    }
+}  // namespace
+
+/**
+ * @brief Tests that nested zones and frame markers end up in the trace of the recording thread.
+ */
+TEST(ProfilerTest, RecordsZonesAndFrames) {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.clear();
+    profiler.start();
+
+    Thread thread("Profiler Test");
+    thread.run([]() {
+        for (int frame = 0; frame < 3; frame++) {
+            RM_PROFILE_FRAME("Frame");
+            RM_PROFILE_SCOPE("Outer");
+            {
+                RM_PROFILE_SCOPE("Inner");
+            }
+        }
+    });
+    thread.join();
+    profiler.stop();
+
+    // Nothing is recorded once stopped
+    {
+        RM_PROFILE_SCOPE("Ignored");
+        RM_PROFILE_FRAME("Ignored");
+    }
+
+    const std::string trace = profiler.exportTrace();
+    EXPECT_EQ(profiler.getEventCount(), 9u);
+    EXPECT_NE(trace.find(R"("name":"thread_name","ph":"M")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("args":{"name":"Profiler Test"})"), std::string::npos);
+    EXPECT_EQ(count(trace, R"("name":"Outer","cat":"zone","ph":"X")"), 3u);
+    EXPECT_EQ(count(trace, R"("name":"Inner","cat":"zone","ph":"X")"), 3u);
+    EXPECT_EQ(count(trace, R"("name":"Frame","cat":"frame","ph":"i")"), 3u);
+    EXPECT_EQ(trace.find("Ignored"), std::string::npos);
+}
+
+/**
+ * @brief Tests that a full buffer keeps only its most recent events.
+ */
+TEST(ProfilerTest, WrapsAroundWhenFull) {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.clear();
+    profiler.setCapacity(5);
+    profiler.start();
+
+    Thread thread("Profiler Wrap Test");
+    thread.run([&profiler]() {
+        for (rome::u64 i = 0; i < 20; i++) {
+            profiler.record(i < 12 ? "Old" : "New", i, i + 1);
+        }
+    });
+    thread.join();
+    profiler.stop();
+    profiler.setCapacity(Profiler::DefaultCapacity);
+
+    // The slot the owner may be writing next is never exported, so a full buffer of 8 yields 7 events
+    const std::string trace = profiler.exportTrace();
+    EXPECT_EQ(count(trace, R"("name":"New")"), 7u);
+    EXPECT_EQ(trace.find(R"("name":"Old")"), std::string::npos);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Position {
+        float x, y;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Position, "Position", Fields().with("x", &Position::x).with("y", &Position::y));
+
+namespace {
+    struct Velocity {
+        float dx, dy;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Velocity, "Velocity", Fields().with("dx", &Velocity::dx).with("dy", &Velocity::dy));
+
+namespace {
+    struct Name {
+        std::string value;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Name, "Name");
+
+/**
+ * @brief Tests that components survive moves between archetypes as they are added and removed.
+ */
+TEST(ArchetypeStorageTest, AddRemoveMigrates) {
+    Component::Registry registry;
+    Component::Archetypes storage(registry);
+    Entity::Registry entities;
+
+    Entity a = entities.create();
+    Entity b = entities.create();
+    storage.create<Position>(a, 1.0f, 2.0f);
+    storage.create<Name>(a, "a");
+    storage.create<Position>(b, 3.0f, 4.0f);
+    EXPECT_EQ(storage.getArchetypeCount(), 2u);
+
+    storage.create<Velocity>(a, 5.0f, 6.0f);
+    EXPECT_TRUE(storage.has<Velocity>(a));
+    EXPECT_FLOAT_EQ(storage.get<Position>(a).y, 2.0f);
+    EXPECT_EQ(storage.get<Name>(a).value, "a");
+
+    storage.remove<Position>(a);
+    EXPECT_FALSE(storage.has<Position>(a));
+    EXPECT_FLOAT_EQ(storage.get<Velocity>(a).dx, 5.0f);
+    EXPECT_EQ(storage.get<Name>(a).value, "a");
+    EXPECT_FLOAT_EQ(storage.get<Position>(b).x, 3.0f);
+
+    storage.destroy(a);
+    EXPECT_FALSE(storage.has<Name>(a));
+    EXPECT_TRUE(storage.has<Position>(b));
+}
+
+/**
+ * @brief Tests that rows moved by swap-and-pop keep their components, across several chunks.
+ */
+TEST(ArchetypeStorageTest, SwapRemoveAcrossChunks) {
+    Component::Registry registry;
+    Component::Archetypes storage(registry, 256);
+    Entity::Registry entities;
+
+    std::vector<Entity> created;
+    for (int i = 0; i < 100; i++) {
+        created.push_back(entities.create());
+        storage.create<Position>(created.back(), static_cast<float>(i), 0.0f);
+    }
+    for (int i = 0; i < 100; i += 3) {
+        storage.remove<Position>(created[i]);
+    }
+    for (int i = 0; i < 100; i++) {
+        if (i % 3 == 0) {
+            EXPECT_FALSE(storage.has<Position>(created[i]));
+        } else {
+            EXPECT_FLOAT_EQ(storage.get<Position>(created[i]).x, static_cast<float>(i));
+        }
+    }
+}
+
+/**
+ * @brief Tests that both ECS backends yield the same query results.
+ */
+TEST(ArchetypeStorageTest, BackendsAgree) {
+    for (ECS::Backend backend : {ECS::Backend::SparseSet, ECS::Backend::Archetype}) {
+        ECS ecs(backend);
+        for (int i = 0; i < 1000; i++) {
+            Entity entity = ecs.createEntity();
+            ecs.addComponent<Position>(entity, static_cast<float>(i), 0.0f);
+            if (i % 2 == 0) ecs.addComponent<Velocity>(entity, 1.0f, 2.0f);
+            if (i % 5 == 0) ecs.addComponent<Name>(entity, std::to_string(i));
+        }
+
+        ecs.each<Position, const Velocity>([](Position& p, const Velocity& v) {
+            p.x += v.dx;
+            p.y += v.dy;
+        });
+
+        int moved = 0;
+        float sum = 0.0f;
+        ecs.each<const Position>([&](const Position& p) {
+            sum += p.x;
+            moved += p.y == 2.0f;
+        });
+        EXPECT_EQ(moved, 500);
+        EXPECT_FLOAT_EQ(sum, 999.0f * 1000.0f / 2.0f + 500.0f);
+    }
+}
+
+/**
+ * @brief Tests that system views walk the matching archetype chunks, honoring exclusions and optional components.
+ */
+TEST(ArchetypeStorageTest, SystemViewsWalkArchetypes) {
+    ECS ecs(ECS::Backend::Archetype);
+    World& world = ecs.getWorld();
+    for (int i = 0; i < 3000; i++) {
+        const Entity entity = ecs.createEntity();
+        ecs.addComponent<Position>(entity, 0.0f, 0.0f);
+        if (i % 3 != 0) ecs.addComponent<Velocity>(entity, 1.0f, 2.0f);
+        if (i % 5 == 0) ecs.addComponent<Name>(entity, "named");
+    }
+
+    int moved = 0;
+    int named = 0;
+    size_t spans = 0;
+    ecs.registerSystem(System::Builder("move", world).writes<Position>().reads<Velocity>().readsOptional<Name>().build([&](System::Context& ctx) {
+        System::View<Position, const Velocity, System::Exclude<Name>> view(ctx);
+        view.parallelEach([](Position& position, const Velocity& velocity) {
+            position.x += velocity.dx;
+            position.y += velocity.dy;
+        });
+        view.each([&](Position&, const Velocity&) { moved++; });
+        System::View<Position, const Velocity>(ctx).chunks([&](std::span<Position> positions, std::span<const Velocity>) {
+            spans += positions.size();
+        });
+        for (auto [position, name] : System::View<const Position, System::Optional<const Name>>(ctx)) {
+            if (name) named += position.x == 0.0f;
+        }
+    }));
+    ecs.update();
+
+    // 2000 entities have a velocity, 400 of which also have a name and are excluded from moving
+    EXPECT_EQ(moved, 1600);
+    EXPECT_EQ(spans, 2000u);
+    // The optional view only needs a position, so it sees all 600 named entities
+    EXPECT_EQ(named, 600);
+    int still = 0;
+    ecs.each<const Position>([&](const Position& position) { still += position.x == 0.0f; });
+    EXPECT_EQ(still, 3000 - 1600);
+}
+
+/**
+ * @brief Tests that views refuse tick filters on the archetype backend, which keeps no ticks.
+ */
+TEST(ArchetypeStorageTest, SystemViewsRejectTickFilters) {
+    ECS ecs(ECS::Backend::Archetype);
+    World& world = ecs.getWorld();
+    ecs.addComponent<Position>(ecs.createEntity(), 1.0f, 2.0f);
+
+    ecs.registerSystem(System::Builder("watch", world).reads<Position>().build([](System::Context& ctx) {
+        System::View<const Position, System::Changed<Position>> view(ctx);
+    }));
+    EXPECT_THROW(ecs.update(), Exception);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Health {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Name {
+        std::string value;
+
+        RM_REFLECT;
+    };
+
+    struct Rank {
+        int value;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Health, "CommandHealth");
+RM_REFLECT_IMPL(Name, "CommandName");
+RM_REFLECT_IMPL(Rank, "CommandRank");
+
+/**
+ * @brief Tests that nothing changes until playback, and that pending entities receive their components.
+ */
+TEST(CommandBufferTest, AppliesOnPlayback) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Entity doomed = ecs.createEntity();
+    ecs.addComponent<Health>(doomed, 1);
+    const Entity stripped = ecs.createEntity();
+    ecs.addComponent<Health>(stripped, 2);
+    ecs.addComponent<Name>(stripped, "stripped");
+
+    Command::Buffer buffer;
+    const Command::Buffer::Pending spawned = buffer.create();
+    buffer.add(spawned, Health{3});
+    buffer.add(spawned, Name{std::string(64, 'x')});
+    buffer.destroy(doomed);
+    buffer.remove<Name>(stripped);
+    EXPECT_EQ(buffer.getSize(), 5u);
+    EXPECT_TRUE(ecs.hasComponents<Health>(doomed));
+
+    buffer.playback(world);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_FALSE(world.entities.isAlive(doomed));
+    EXPECT_FALSE(ecs.hasComponents<Name>(stripped));
+    EXPECT_TRUE(ecs.hasComponents<Health>(stripped));
+
+    ASSERT_EQ(world.components.getPool<Name>()->getIndices().size(), 1u);
+    const rome::u64 index = world.components.getPool<Name>()->getIndices()[0];
+    EXPECT_EQ(world.components.getPool<Name>()->at(index).value, std::string(64, 'x'));
+    EXPECT_EQ(world.components.getPool<Health>()->at(index).value, 3);
+}
+
+/**
+ * @brief Tests that commands targeting entities destroyed in the meantime are skipped.
+ */
+TEST(CommandBufferTest, SkipsDeadEntities) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Entity entity = ecs.createEntity();
+
+    Command::Buffer buffer;
+    buffer.destroy(entity);
+    buffer.add(entity, Health{1});
+    buffer.destroy(entity);
+    buffer.playback(world);
+    EXPECT_FALSE(world.entities.isAlive(entity));
+    EXPECT_TRUE(world.components.getPool<Health>()->getIndices().empty());
+}
+
+/**
+ * @brief Tests that commands deferred by parallel systems play back in system order, whichever thread ran them.
+ */
+TEST(CommandBufferTest, PlaysBackInSystemOrder) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    constexpr int systems = 8;
+    for (int i = 0; i < systems; i++) {
+        ecs.registerSystem(System::Builder("spawner " + std::to_string(i), world).build([i](System::Context& ctx) {
+            Command::Buffer& commands = ctx.getCommands();
+            for (int j = 0; j < 4; j++) {
+                commands.add(commands.create(), Health{i * 4 + j});
+            }
+        }));
+    }
+    ASSERT_EQ(ecs.getScheduler().getStages().size(), 1u);
+
+    for (int run = 0; run < 10; run++) {
+        ecs.update();
+        Component::Pool<Health>* healths = world.components.getPool<Health>();
+        ASSERT_EQ(healths->getIndices().size(), static_cast<rome::u64>((run + 1) * systems * 4));
+        for (int i = 0; i < systems * 4; i++) {
+            EXPECT_EQ(healths->at(run * systems * 4 + i).value, i);
+        }
+    }
+}
+
+/**
+ * @brief Tests that a system can remove components from the entities it iterates, the changes landing after the stage.
+ */
+TEST(CommandBufferTest, DefersRemovalWhileIterating) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    for (int i = 0; i < 100; i++) {
+        ecs.addComponent<Health>(ecs.createEntity(), i);
+    }
+
+    rome::u64 seen = 0;
+    ecs.registerSystem(System::Builder("reaper", world).reads<Health>().allowPartial().build([&seen](System::Context& ctx) {
+        Component::Pool<Health>* healths = ctx.world.components.getPool<Health>();
+        const std::span<const rome::u64> indices = healths->getIndices();
+        for (rome::u64 i = 0; i < indices.size(); i++) {
+            seen++;
+            if (healths->at(indices[i]).value % 2 == 0) {
+                ctx.getCommands().remove<Health>(ctx.world.entities.get(indices[i]));
+            }
+        }
+    }));
+    ecs.update();
+    EXPECT_EQ(seen, 100u);
+    EXPECT_EQ(world.components.getPool<Health>()->getIndices().size(), 50u);
+}
+
+/**
+ * @brief Tests that commands recorded from a parallel view play back in entity order, around those of the system itself.
+ */
+TEST(CommandBufferTest, ParallelEachPlaysBackInOrder) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    constexpr int count = 1000;
+    for (int i = 0; i < count; i++) {
+        ecs.addComponent<Health>(ecs.createEntity(), i);
+    }
+
+    JobSystem jobs(4);
+    ecs.registerSystem(System::Builder("ranker", world).reads<Health>().allowPartial().build([&jobs](System::Context& ctx) {
+        Command::Buffer& commands = ctx.getCommands();
+        commands.add(commands.create(), Rank{-1});
+        System::View<const Health>(ctx).parallelEach(
+            [&ctx](const Health& health) {
+                Command::Buffer& local = ctx.getCommands();
+                local.add(local.create(), Rank{health.value});
+            },
+            7, jobs);
+        ctx.getCommands().add(ctx.getCommands().create(), Rank{count});
+    }));
+
+    for (int run = 0; run < 10; run++) {
+        ecs.update();
+        Component::Pool<Rank>* ranks = world.components.getPool<Rank>();
+        ASSERT_EQ(ranks->getIndices().size(), static_cast<rome::u64>((run + 1) * (count + 2)));
+        const rome::u64 base = count + run * (count + 2);
+        for (int i = 0; i < count + 2; i++) {
+            EXPECT_EQ(ranks->at(base + i).value, i - 1);
+        }
+    }
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+
 #include "ecs/component/registry.hpp"
 #include "ecs/entity/registry.hpp"
 #include "reflection/traits/field.hpp"
@@ -49,3 +51,75 @@ TEST(ComponentRegistryTest, CreateDestroyReuse) {
         EXPECT_FLOAT_EQ(p2.y, 4.0f);
     }
 }
+
+struct Velocity {
+    float dx, dy;
+
+    RM_REFLECT;
+};
+RM_REFLECT_IMPL(Velocity, "Velocity", Fields().with("dx", &Velocity::dx).with("dy", &Velocity::dy));
+
+TEST(ComponentRegistryTest, SignatureTracksComponents) {
+    Entity::Registry entityRegistry;
+    Component::Registry componentRegistry;
+    Entity entity = entityRegistry.create();
+
+    EXPECT_FALSE(componentRegistry.has<Position>(entity));
+    componentRegistry.create<Position>(entity, Position{1.0f, 2.0f});
+    componentRegistry.create<Velocity>(entity, Velocity{3.0f, 4.0f});
+    EXPECT_TRUE((componentRegistry.has<Position, Velocity>(entity)));
+    EXPECT_EQ(componentRegistry.getSignature(entity.getIndex()).count(), 2u);
+
+    componentRegistry.remove<Velocity>(entity);
+    EXPECT_TRUE(componentRegistry.has<Position>(entity));
+    EXPECT_FALSE((componentRegistry.has<Position, Velocity>(entity)));
+    EXPECT_TRUE(componentRegistry.getSignature(entity.getIndex()).includes(componentRegistry.getMask<Position>()));
+}
+
+TEST(ComponentRegistryTest, DestroyRemovesOnlyPresentComponents) {
+    Entity::Registry entityRegistry;
+    Component::Registry componentRegistry;
+    Entity doomed = entityRegistry.create();
+    Entity survivor = entityRegistry.create();
+
+    componentRegistry.create<Position>(doomed, Position{1.0f, 1.0f});
+    componentRegistry.create<Position>(survivor, Position{2.0f, 2.0f});
+    componentRegistry.create<Velocity>(survivor, Velocity{5.0f, 5.0f});
+
+    componentRegistry.destroy(doomed);
+    EXPECT_FALSE(componentRegistry.has<Position>(doomed));
+    EXPECT_FALSE(componentRegistry.getPool<Position>()->contains(doomed.getIndex()));
+    EXPECT_EQ(componentRegistry.getPool<Position>()->getIndices().size(), 1u);
+    EXPECT_TRUE((componentRegistry.has<Position, Velocity>(survivor)));
+    EXPECT_FLOAT_EQ(componentRegistry.get<Position>(survivor).x, 2.0f);
+    EXPECT_FLOAT_EQ(componentRegistry.get<Velocity>(survivor).dx, 5.0f);
+}
+
+TEST(ComponentRegistryTest, IDsAreDensePerRegistry) {
+    Component::Registry first;
+    Component::Registry second;
+    EXPECT_EQ(first.enter<Position>(), 0u);
+    EXPECT_EQ(first.enter<Velocity>(), 1u);
+    EXPECT_EQ(second.enter<Velocity>(), 0u);
+    EXPECT_EQ(second.enter<Position>(), 1u);
+    EXPECT_EQ(first.enter<Position>(), 0u);
+    EXPECT_EQ(second.getName(1), "Position");
+    EXPECT_NE(static_cast<Component::Storage*>(first.getPool<Position>()), static_cast<Component::Storage*>(second.getPool<Position>()));
+}
+
+TEST(ComponentRegistryTest, ConcurrentFirstUseSharesPool) {
+    Component::Registry componentRegistry;
+    constexpr int threads = 8;
+    std::vector<Component::Pool<Velocity>*> pools(threads);
+    std::vector<std::thread> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back([&, i] { pools[i] = componentRegistry.getPool<Velocity>(); });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (Component::Pool<Velocity>* pool : pools) {
+        EXPECT_EQ(pool, pools[0]);
+    }
+    EXPECT_EQ(componentRegistry.getCount(), 1u);
+}
@@ -0,0 +1,302 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Hit {
+        int source;
+        int damage;
+
+        RM_REFLECT;
+    };
+
+    struct Jump {
+        int height;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Jump, "EventJump", Fields().with("height", &Jump::height));
+RM_REFLECT_IMPL(Hit, "EventHit", Fields().with("source", &Hit::source).with("damage", &Hit::damage));
+
+namespace {
+    struct Target {
+        int id;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Target, "EventTarget", Fields().with("id", &Target::id));
+
+/**
+ * @brief Tests that events become readable after a swap, and are gone after the next one.
+ */
+TEST(EventStorageTest, SwapPublishesEvents) {
+    Event::Storage<Hit> queue;
+    EXPECT_TRUE(queue.empty());
+    queue.push(Hit{0, 1});
+    queue.emplace(Hit{0, 2});
+    EXPECT_TRUE(queue.read().empty());
+    EXPECT_FALSE(queue.empty());
+
+    queue.swap();
+    ASSERT_EQ(queue.read().size(), 2u);
+    EXPECT_EQ(queue.read()[0].damage, 1);
+    EXPECT_EQ(queue.read()[1].damage, 2);
+
+    queue.swap();
+    EXPECT_TRUE(queue.read().empty());
+    EXPECT_TRUE(queue.empty());
+}
+
+/**
+ * @brief Tests that events pushed under different keys are read in key order, then push order.
+ */
+TEST(EventStorageTest, MergesInKeyOrder) {
+    Event::Storage<Hit> queue;
+    Event::Queue::setKey(2);
+    queue.push(Hit{2, 0});
+    Event::Queue::setKey(1);
+    queue.push(Hit{1, 0});
+    queue.push(Hit{1, 1});
+    Event::Queue::setKey(2);
+    queue.push(Hit{2, 1});
+    Event::Queue::setKey(0);
+
+    queue.swap();
+    const std::vector<std::pair<int, int>> expected{{1, 0}, {1, 1}, {2, 0}, {2, 1}};
+    std::vector<std::pair<int, int>> actual;
+    for (const Hit& hit : queue.read()) {
+        actual.emplace_back(hit.source, hit.damage);
+    }
+    EXPECT_EQ(actual, expected);
+}
+
+/**
+ * @brief Tests that several threads can push at once, and that the merged order does not depend on which thread ran first.
+ */
+TEST(EventStorageTest, ThreadsPushConcurrently) {
+    Event::Storage<Hit> queue;
+    constexpr int producers = 8;
+    constexpr int events = 1000;
+
+    for (int round = 0; round < 3; round++) {
+        std::vector<std::thread> threads;
+        for (int i = producers - 1; i >= 0; i--) {
+            threads.emplace_back([&queue, i] {
+                Event::Queue::setKey(i);
+                for (int j = 0; j < events; j++) {
+                    queue.push(Hit{i, j});
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        queue.swap();
+        ASSERT_EQ(queue.read().size(), static_cast<rome::u64>(producers * events));
+        for (int i = 0; i < producers * events; i++) {
+            EXPECT_EQ(queue.read()[i].source, i / events);
+            EXPECT_EQ(queue.read()[i].damage, i % events);
+        }
+    }
+}
+
+/**
+ * @brief Tests that the bus hands out one queue per event type, under dense IDs, and rejects unknown or duplicate types.
+ */
+TEST(EventBusTest, QueuesByType) {
+    ECS ecs;
+    Event::Bus& bus = ecs.getBus();
+    EXPECT_THROW(bus.queue<Hit>(), Exception);
+
+    const Event::ID hit = bus.enter<Hit>();
+    const Event::ID jump = bus.enter<Jump>();
+    EXPECT_EQ(hit, 0u);
+    EXPECT_EQ(jump, 1u);
+    EXPECT_EQ(ecs.getWorld().events.get<Jump>(), jump);
+    EXPECT_THROW(bus.enter<Hit>(), Exception);
+
+    bus.queue<Hit>().push(Hit{0, 5});
+    bus.queue<Jump>().push(Jump{2});
+    bus.swap();
+    ASSERT_EQ(bus.queue<Hit>().read().size(), 1u);
+    EXPECT_EQ(bus.queue<Hit>().read()[0].damage, 5);
+    EXPECT_EQ(bus.queue<Jump>().read()[0].height, 2);
+
+    ECS other;
+    EXPECT_EQ(other.getBus().enter<Jump>(), 0u);
+    EXPECT_TRUE(other.getBus().queue<Jump>().read().empty());
+}
+
+/**
+ * @brief Pushes damages [0, count) into a queue, swaps it, and returns the damages read back.
+ */
+static std::vector<int> roundTrip(Event::Storage<Hit>& queue, int count) {
+    for (int i = 0; i < count; i++) {
+        queue.push(Hit{0, i});
+    }
+    queue.swap();
+    std::vector<int> damages;
+    for (const Hit& hit : queue.read()) {
+        damages.push_back(hit.damage);
+    }
+    return damages;
+}
+
+/**
+ * @brief Tests that bounded queues apply their overflow policy, count overflows, and report them to the metrics.
+ */
+TEST(EventStorageTest, BoundedQueuesOverflow) {
+    Metrics::getInstance().registerThread("Event Overflow");
+    const rome::u64 droppedBefore = Metrics::getInstance().getDroppedEvents();
+
+    Event::Storage<Hit> oldest(Event::Bounds{4, Event::Overflow::DropOldest});
+    EXPECT_EQ(roundTrip(oldest, 10), (std::vector<int>{6, 7, 8, 9}));
+    EXPECT_EQ(roundTrip(oldest, 3), (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(oldest.getDropped(), 6u);
+
+    Event::Storage<Hit> newest(Event::Bounds{4, Event::Overflow::DropNewest});
+    EXPECT_EQ(roundTrip(newest, 10), (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(newest.getDropped(), 6u);
+
+    Event::Storage<Hit> spill(Event::Bounds{4, Event::Overflow::Spill});
+    EXPECT_EQ(roundTrip(spill, 6), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(roundTrip(spill, 2), (std::vector<int>{0, 1}));
+    EXPECT_EQ(spill.getSpilled(), 2u);
+    EXPECT_EQ(spill.getDropped(), 0u);
+
+    EXPECT_EQ(Metrics::getInstance().getDroppedEvents(), droppedBefore + 12);
+    EXPECT_GE(Metrics::getInstance().getSpilledEvents(), 2u);
+    EXPECT_THROW(Event::Storage<Hit>(Event::Bounds{0}), Exception);
+    Metrics::getInstance().unregisterThread();
+}
+
+/**
+ * @brief Tests that a producer pushing into a full blocking queue waits for the next swap, losing nothing.
+ */
+TEST(EventStorageTest, BoundedQueueBlocks) {
+    Event::Storage<Hit> queue(Event::Bounds{4, Event::Overflow::Block});
+    constexpr int count = 50;
+    std::thread producer([&queue] {
+        for (int i = 0; i < count; i++) {
+            queue.push(Hit{0, i});
+        }
+    });
+
+    std::vector<int> damages;
+    while (damages.size() < count) {
+        queue.swap();
+        EXPECT_LE(queue.read().size(), 4u);
+        for (const Hit& hit : queue.read()) {
+            damages.push_back(hit.damage);
+        }
+        std::this_thread::yield();
+    }
+    producer.join();
+    for (int i = 0; i < count; i++) {
+        EXPECT_EQ(damages[i], i);
+    }
+    EXPECT_EQ(queue.getDropped(), 0u);
+}
+
+/**
+ * @brief Tests that a coalescing queue keeps one event per key, at the place of its first occurrence, and the latest one.
+ */
+TEST(EventStorageTest, CoalescesByKey) {
+    EXPECT_THROW(Event::Storage<Hit>(Event::Coalescing<Hit>{}), Exception);
+
+    Event::Storage<Hit> queue(Event::Coalescing<Hit>{[](const Hit& hit) { return static_cast<rome::u64>(hit.source); }});
+    for (int i = 0; i < 1000; i++) {
+        queue.push(Hit{i % 3, i});
+    }
+    queue.swap();
+    ASSERT_EQ(queue.read().size(), 3u);
+    const int latest[] = {999, 997, 998};
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(queue.read()[i].source, i);
+        EXPECT_EQ(queue.read()[i].damage, latest[i]);
+    }
+    EXPECT_EQ(queue.getCoalesced(), 997u);
+
+    queue.push(Hit{7, 1});
+    queue.swap();
+    ASSERT_EQ(queue.read().size(), 1u);
+    EXPECT_EQ(queue.read()[0].source, 7);
+}
+
+/**
+ * @brief Tests that a coalescing queue entered into the bus folds duplicates through its merge function.
+ */
+TEST(EventBusTest, MergesCoalescedEvents) {
+    ECS ecs;
+    Event::Bus& bus = ecs.getBus();
+    bus.enter<Hit>(Event::Coalescing<Hit>{[](const Hit& hit) { return static_cast<rome::u64>(hit.source); },
+                                          [](Hit& kept, Hit&& duplicate) { kept.damage += duplicate.damage; }});
+
+    Event::Storage<Hit>& hits = bus.queue<Hit>();
+    for (int source = 100; source > 0; source--) {
+        hits.push(Hit{source, 1});
+        hits.push(Hit{source, source});
+    }
+    hits.push(Hit{50, 1000});
+    bus.swap();
+    ASSERT_EQ(hits.read().size(), 100u);
+    for (int i = 0; i < 100; i++) {
+        const int source = 100 - i;
+        EXPECT_EQ(hits.read()[i].source, source);
+        EXPECT_EQ(hits.read()[i].damage, 1 + source + (source == 50 ? 1000 : 0));
+    }
+    EXPECT_EQ(hits.getCoalesced(), 101u);
+}
+
+/**
+ * @brief Tests that a system pushing into a blocking queue fails instead of waiting for a swap that cannot happen.
+ */
+TEST(EventBusTest, SystemsCannotBlock) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    ecs.getBus().enter<Hit>(Event::Bounds{1, Event::Overflow::Block});
+    ecs.getBus().queue<Hit>().push(Hit{0, 1});
+
+    ecs.registerSystem(System::Builder("shooter", world).build([](System::Context& ctx) { ctx.world.bus.queue<Hit>().push(Hit{0, 2}); }));
+    EXPECT_THROW(ecs.update(), Exception);
+    EXPECT_EQ(ecs.getBus().queue<Hit>().read().size(), 1u);
+}
+
+/**
+ * @brief Tests that events pushed from a parallel view are read in entity order, around those of the system itself.
+ */
+TEST(EventBusTest, ParallelEachPushesInOrder) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    constexpr int count = 1000;
+    for (int i = 0; i < count; i++) {
+        ecs.addComponent<Target>(ecs.createEntity(), i);
+    }
+    ecs.getBus().enter<Hit>();
+
+    JobSystem jobs(4);
+    ecs.registerSystem(System::Builder("shooter", world).reads<Target>().allowPartial().build([&jobs](System::Context& ctx) {
+        Event::Storage<Hit>& hits = ctx.world.bus.queue<Hit>();
+        hits.push(Hit{-1, 0});
+        System::View<const Target>(ctx).parallelEach([&hits](const Target& target) { hits.push(Hit{target.id, 0}); }, 7, jobs);
+        hits.push(Hit{count, 0});
+    }));
+
+    for (int run = 0; run < 10; run++) {
+        ecs.update();
+        ecs.getBus().swap();
+        const auto hits = ecs.getBus().queue<Hit>().read();
+        ASSERT_EQ(hits.size(), static_cast<rome::u64>(count + 2));
+        for (int i = 0; i < count + 2; i++) {
+            EXPECT_EQ(hits[i].source, i - 1);
+        }
+    }
+}
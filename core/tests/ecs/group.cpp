@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Health {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Armor {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Tag {
+        int value;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Health, "Health");
+RM_REFLECT_IMPL(Armor, "Armor");
+RM_REFLECT_IMPL(Tag, "Tag");
+
+/**
+ * @brief Builds a descriptor reading and writing the given components.
+ */
+static System::Descriptor describe(World& world, const std::string& name, std::initializer_list<Component::ID> writes,
+                                   std::initializer_list<Component::ID> reads, rome::b8 requireFull, rome::b8 allowPartial) {
+    return System::Descriptor{world,
+                              name,
+                              nullptr,
+                              BitSet<Component::ID>::create(reads),
+                              BitSet<Component::ID>::create(writes),
+                              {},
+                              {},
+                              requireFull,
+                              allowPartial,
+                              true};
+}
+
+/**
+ * @brief Tests that entities created before the group are packed when the group is built.
+ */
+TEST(OwningGroupTest, PacksExistingEntities) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; i++) {
+        entities.push_back(ecs.createEntity());
+        ecs.addComponent<Health>(entities.back(), i);
+        if (i % 2) ecs.addComponent<Armor>(entities.back(), i * 10);
+    }
+
+    System::Group group(describe(world, "packed", {ecs.registerComponent<Health>(), ecs.registerComponent<Armor>()}, {}, true, false));
+    EXPECT_EQ(group.getSize(), 5u);
+
+    System::Context ctx{group, world};
+    int sum = 0;
+    for (auto [health, armor] : System::View<Health, const Armor>(ctx)) {
+        EXPECT_EQ(armor.value, health.value * 10);
+        health.value++;
+        sum += armor.value;
+    }
+    EXPECT_EQ(sum, 250);
+    EXPECT_EQ(ecs.getComponent<Health>(entities[3]).value, 4);
+    EXPECT_EQ(ecs.getComponent<Health>(entities[2]).value, 2);
+}
+
+/**
+ * @brief Tests the prefix invariant of an owning group after random add / remove sequences.
+ */
+TEST(OwningGroupTest, PrefixInvariantUnderChurn) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Component::ID health = ecs.registerComponent<Health>();
+    const Component::ID armor = ecs.registerComponent<Armor>();
+    const Component::ID tag = ecs.registerComponent<Tag>();
+    System::Group group(describe(world, "churn", {health, armor}, {tag}, false, true));
+
+    std::vector<Entity> entities;
+    for (int i = 0; i < 64; i++) {
+        entities.push_back(ecs.createEntity());
+    }
+
+    auto* healths = world.components.getPool<Health>();
+    auto* armors = world.components.getPool<Armor>();
+    auto* tags = world.components.getPool<Tag>();
+
+    std::mt19937 rng(1234);
+    for (int step = 0; step < 5000; step++) {
+        const Entity& entity = entities[rng() % entities.size()];
+        const rome::u64 index = entity.getIndex();
+        switch (rng() % 3) {
+            case 0:
+                healths->contains(index) ? ecs.removeComponent<Health>(entity) : (void)ecs.addComponent<Health>(entity, step);
+                break;
+            case 1:
+                armors->contains(index) ? ecs.removeComponent<Armor>(entity) : (void)ecs.addComponent<Armor>(entity, step);
+                break;
+            default:
+                tags->contains(index) ? ecs.removeComponent<Tag>(entity) : (void)ecs.addComponent<Tag>(entity, step);
+                break;
+        }
+
+        // Members are exactly the entities with every tracked component, and sit in the same prefix of each owned pool
+        rome::u64 expected = 0;
+        for (const Entity& e : entities) {
+            const rome::u64 i = e.getIndex();
+            const rome::b8 member = healths->contains(i) && armors->contains(i) && tags->contains(i);
+            expected += member;
+            if (member) {
+                ASSERT_LT(healths->getPosition(i), group.getSize());
+                ASSERT_EQ(healths->getPosition(i), armors->getPosition(i));
+            } else {
+                ASSERT_TRUE(!healths->contains(i) || healths->getPosition(i) >= group.getSize());
+                ASSERT_TRUE(!armors->contains(i) || armors->getPosition(i) >= group.getSize());
+            }
+        }
+        ASSERT_EQ(group.getSize(), expected);
+    }
+}
+
+/**
+ * @brief Tests that two groups cannot pack the same component, and that a conflicting group observes instead.
+ */
+TEST(OwningGroupTest, ConflictingOwnershipObserves) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Component::ID health = ecs.registerComponent<Health>();
+    const Component::ID armor = ecs.registerComponent<Armor>();
+    for (int i = 0; i < 6; i++) {
+        Entity entity = ecs.createEntity();
+        ecs.addComponent<Health>(entity, i);
+        if (i < 4) ecs.addComponent<Armor>(entity, i);
+    }
+
+    System::Group first(describe(world, "first", {health, armor}, {}, true, false));
+    System::Group same(describe(world, "same", {health, armor}, {}, true, false));
+    EXPECT_THROW(world.components.own({health}, {}), Exception);
+
+    System::Group other(describe(world, "other", {health}, {}, true, false));
+    EXPECT_TRUE(first.isPacked(health));
+    EXPECT_FALSE(other.isPacked(health));
+    EXPECT_EQ(first.getSize(), 4u);
+    EXPECT_EQ(other.getSize(), 6u);
+
+    System::Context ctx{other, world};
+    int sum = 0;
+    for (auto [h] : System::View<const Health>(ctx)) {
+        sum += h.value;
+    }
+    EXPECT_EQ(sum, 15);
+}
+
+/**
+ * @brief Tests that destroying an entity removes it from the group along with its components.
+ */
+TEST(OwningGroupTest, DestroyLeavesGroup) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Component::ID health = ecs.registerComponent<Health>();
+    const Component::ID armor = ecs.registerComponent<Armor>();
+    System::Group group(describe(world, "destroy", {health, armor}, {}, false, true));
+
+    std::vector<Entity> entities;
+    for (int i = 0; i < 8; i++) {
+        entities.push_back(ecs.createEntity());
+        ecs.addComponent<Health>(entities.back(), i);
+        ecs.addComponent<Armor>(entities.back(), i);
+    }
+    ASSERT_EQ(group.getSize(), 8u);
+
+    ecs.destroyEntity(entities[3]);
+    EXPECT_EQ(group.getSize(), 7u);
+    EXPECT_FALSE((ecs.hasComponents<Health, Armor>(entities[3])));
+    EXPECT_TRUE((ecs.hasComponents<Health, Armor>(entities[4])));
+    EXPECT_EQ(world.components.getPool<Health>()->getIndices().size(), 7u);
+
+    // The recycled index starts out with no components
+    const Entity reused = ecs.createEntity();
+    EXPECT_EQ(reused.getIndex(), entities[3].getIndex());
+    EXPECT_FALSE(ecs.hasComponents<Health>(reused));
+}
+
+/**
+ * @brief Tests that erasing a system releases the pools its group packed, so another group can pack them.
+ */
+TEST(OwningGroupTest, ErasedSystemReleasesOwnership) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Component::ID health = ecs.registerComponent<Health>();
+    ecs.registerComponent<Armor>();
+    for (int i = 0; i < 6; i++) {
+        Entity entity = ecs.createEntity();
+        ecs.addComponent<Health>(entity, i);
+        if (i % 2 == 0) ecs.addComponent<Armor>(entity, i);
+    }
+
+    auto noop = [](System::Context&) {};
+    const System::ID first = ecs.registerSystem(System::Builder("first", world).writes<Health, Armor>().build(noop));
+    const System::ID second = ecs.registerSystem(System::Builder("second", world).writes<Health, Armor>().build(noop));
+    EXPECT_FALSE(world.components.isOwnable({health}, {}));
+    EXPECT_TRUE(world.systems.getGroup(second).isPacked(health));
+
+    // The ownership is shared, so it outlives the first of its groups
+    world.systems.erase(first);
+    EXPECT_FALSE(world.components.isOwnable({health}, {}));
+    world.systems.erase(second);
+    EXPECT_TRUE(world.components.isOwnable({health}, {}));
+
+    const System::ID owner = ecs.registerSystem(System::Builder("owner", world).writes<Health>().build(noop));
+    EXPECT_TRUE(world.systems.getGroup(owner).isPacked(health));
+    EXPECT_EQ(world.systems.getGroup(owner).getSize(), 6u);
+    Component::Ownership& ownership = world.components.own({health}, {});
+    EXPECT_EQ(ownership.getLength(), 6u);
+    world.components.disown(ownership);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Position {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Velocity {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Score {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Ping {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Pong {
+        int value;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Position, "Position");
+RM_REFLECT_IMPL(Velocity, "Velocity");
+RM_REFLECT_IMPL(Score, "Score");
+RM_REFLECT_IMPL(Ping, "SchedulerPing");
+RM_REFLECT_IMPL(Pong, "SchedulerPong");
+
+/**
+ * @brief Tests that only conflicting systems are split into later stages.
+ */
+TEST(SchedulerTest, StagesFollowConflicts) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    auto noop = [](System::Context&) {};
+
+    const System::ID move = ecs.registerSystem(System::Builder("move", world).reads<Velocity>().writes<Position>().build(noop));
+    const System::ID score = ecs.registerSystem(System::Builder("score", world).writes<Score>().build(noop));
+    const System::ID render = ecs.registerSystem(System::Builder("render", world).reads<Position>().allowPartial().build(noop));
+    const System::ID emit = ecs.registerSystem(System::Builder("emit", world).emits({3}).build(noop));
+    const System::ID listen = ecs.registerSystem(System::Builder("listen", world).listens({3}).build(noop));
+    const System::ID steer = ecs.registerSystem(System::Builder("steer", world).writes<Velocity>().build(noop));
+
+    const std::vector<std::vector<System::ID>> expected{{move, score, emit}, {render, listen, steer}};
+    EXPECT_EQ(ecs.getScheduler().getStages(), expected);
+    EXPECT_EQ(ecs.getScheduler().toString(), "Stage 0: move score emit\nStage 1: render listen steer\n");
+
+    ecs.getWorld().systems.erase(move);
+    const std::vector<std::vector<System::ID>> rebuilt{{score, render, emit, steer}, {listen}};
+    EXPECT_EQ(ecs.getScheduler().getStages(), rebuilt);
+}
+
+/**
+ * @brief Tests that every active system runs once per update and conflicting systems see each other's writes.
+ */
+TEST(SchedulerTest, RunsStagesInOrder) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    for (int i = 0; i < 100; i++) {
+        Entity entity = ecs.createEntity();
+        ecs.addComponent<Position>(entity, 0);
+        ecs.addComponent<Velocity>(entity, i);
+    }
+
+    std::atomic<int> independent{0};
+    int seen = 0;
+    ecs.registerSystem(System::Builder("move", world).reads<Velocity>().writes<Position>().requireFull().build([](System::Context& ctx) {
+        for (auto [position, velocity] : System::View<Position, const Velocity>(ctx)) {
+            position.value += velocity.value;
+        }
+    }));
+    for (int i = 0; i < 8; i++) {
+        ecs.registerSystem(
+            System::Builder("independent " + std::to_string(i), world).build([&independent](System::Context&) { independent++; }));
+    }
+    ecs.registerSystem(System::Builder("sum", world).reads<Position>().allowPartial().build([&seen](System::Context& ctx) {
+        for (auto [position] : System::View<const Position>(ctx)) {
+            seen += position.value;
+        }
+    }));
+    const System::ID disabled =
+        ecs.registerSystem(System::Builder("disabled", world).build([&independent](System::Context&) { independent += 100; }));
+    world.systems.get(disabled).active = false;
+
+    EXPECT_EQ(ecs.getScheduler().getStages().size(), 2u);
+    ecs.update();
+    ecs.update();
+    EXPECT_EQ(independent.load(), 16);
+    EXPECT_EQ(seen, 4950 + 2 * 4950);
+}
+
+/**
+ * @brief Tests that a failing system makes the update throw, whether it ran inline or on a worker.
+ */
+TEST(SchedulerTest, RethrowsSystemFailures) {
+    for (int failing = 0; failing < 8; failing++) {
+        ECS ecs;
+        World& world = ecs.getWorld();
+        std::atomic<int> ran{0};
+        for (int i = 0; i < 8; i++) {
+            ecs.registerSystem(System::Builder("system " + std::to_string(i), world).build([&ran, i, failing](System::Context&) {
+                if (i == failing) throw i;
+                ran++;
+            }));
+        }
+        ASSERT_EQ(ecs.getScheduler().getStages().size(), 1u);
+        EXPECT_THROW(ecs.update(), int);
+        EXPECT_EQ(ran.load(), 7);
+    }
+}
+
+/**
+ * @brief Tests that reactive systems only run on updates where an event they listen to was emitted the update before.
+ */
+TEST(SchedulerTest, ReactiveSystemsWakeOnEvents) {
+    ECS ecs;
+    World& world = ecs.getWorld();
+    const Event::ID ping = ecs.getBus().enter<Ping>();
+    const Event::ID pong = ecs.getBus().enter<Pong>();
+
+    int fire = 0;
+    ecs.registerSystem(System::Builder("emit", world).emits({ping}).build([&fire](System::Context& ctx) {
+        for (int i = 0; i < fire; i++) {
+            ctx.world.bus.queue<Ping>().push(Ping{i});
+        }
+    }));
+    int runs = 0;
+    rome::u64 received = 0;
+    ecs.registerSystem(System::Builder("react", world).listens({ping}).reactive().build([&](System::Context& ctx) {
+        runs++;
+        received += ctx.world.bus.queue<Ping>().read().size();
+    }));
+    ecs.registerSystem(System::Builder("idle", world).listens({pong}).reactive().build([](System::Context&) { FAIL(); }));
+    int polls = 0;
+    ecs.registerSystem(System::Builder("poll", world).listens({ping}).build([&polls](System::Context&) { polls++; }));
+
+    fire = 3;
+    ecs.update();
+    EXPECT_EQ(runs, 0);
+    EXPECT_EQ(ecs.getScheduler().getSkipped(), 2u);
+
+    fire = 0;
+    ecs.update();
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(received, 3u);
+    EXPECT_EQ(ecs.getScheduler().getSkipped(), 1u);
+
+    ecs.update();
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(ecs.getScheduler().getSkipped(), 2u);
+    EXPECT_EQ(polls, 3);
+}
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include "ecs/ecs.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Position {
+        float x;
+
+        RM_REFLECT;
+    };
+
+    struct Velocity {
+        float x;
+
+        RM_REFLECT;
+    };
+
+    struct Mass {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Frozen {
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Position, "Position");
+RM_REFLECT_IMPL(Velocity, "Velocity");
+RM_REFLECT_IMPL(Mass, "Mass");
+RM_REFLECT_IMPL(Frozen, "Frozen");
+
+/**
+ * @brief A world of 1000 moving entities, a third of which also have a mass.
+ */
+class ViewTest : public ::testing::Test {
+    protected:
+    ECS ecs;
+    World& world = ecs.getWorld();
+
+    void SetUp() override {
+        for (int i = 0; i < 1000; i++) {
+            Entity entity = ecs.createEntity();
+            ecs.addComponent<Position>(entity, 0.0f);
+            ecs.addComponent<Velocity>(entity, static_cast<float>(i));
+            if (i % 3 == 0) ecs.addComponent<Mass>(entity, i);
+        }
+    }
+
+    /**
+     * @brief Builds a group packing position and velocity, optionally also requiring mass.
+     * @param optionalReads The components the system reads outside its group.
+     * @param optionalWrites The components the system writes outside its group.
+     */
+    System::Group makeGroup(const std::string& name, rome::b8 massive, BitSet<Component::ID> optionalReads = {},
+                            BitSet<Component::ID> optionalWrites = {}) {
+        const Component::ID position = ecs.registerComponent<Position>();
+        const Component::ID velocity = ecs.registerComponent<Velocity>();
+        const Component::ID mass = ecs.registerComponent<Mass>();
+        BitSet<Component::ID> reads = massive ? BitSet<Component::ID>::create({velocity, mass}) : BitSet<Component::ID>::create({velocity});
+        System::Descriptor descriptor{world, name, nullptr, reads, BitSet<Component::ID>::create({position}), {}, {}, !massive, massive, true};
+        descriptor.optionalReads = std::move(optionalReads);
+        descriptor.optionalWrites = std::move(optionalWrites);
+        return System::Group(descriptor);
+    }
+};
+
+/**
+ * @brief Tests that each() and parallelEach() visit the same entities as the iterator.
+ */
+TEST_F(ViewTest, EachMatchesIterator) {
+    System::Group group = makeGroup("move", false);
+    System::Context ctx{group, world};
+    System::View<Position, const Velocity> view(ctx);
+    ASSERT_EQ(view.getSize(), 1000u);
+
+    view.each([](Position& position, const Velocity& velocity) { position.x += velocity.x; });
+    view.parallelEach([](Position& position, const Velocity& velocity) { position.x += velocity.x; }, 16);
+
+    float sum = 0.0f;
+    for (auto [position, velocity] : view) {
+        EXPECT_EQ(position.x, 2 * velocity.x);
+        sum += position.x;
+    }
+    EXPECT_EQ(sum, 999000.0f);
+}
+
+/**
+ * @brief Tests that chunks() hands out aligned spans of packed components, and refuses unpacked ones.
+ */
+TEST_F(ViewTest, ChunksSpanPackedComponents) {
+    System::Group group = makeGroup("move", false);
+    System::Context ctx{group, world};
+
+    rome::u64 visited = 0;
+    rome::u64 calls = 0;
+    System::View<Position, const Velocity>(ctx).chunks(
+        [&](std::span<Position> positions, std::span<const Velocity> velocities) {
+            ASSERT_EQ(positions.size(), velocities.size());
+            EXPECT_LE(positions.size(), 128u);
+            for (rome::u64 i = 0; i < positions.size(); i++) {
+                positions[i].x = velocities[i].x * 2;
+            }
+            visited += positions.size();
+            calls++;
+        },
+        128);
+    EXPECT_EQ(visited, 1000u);
+    EXPECT_EQ(calls, 8u);
+    for (auto [position, velocity] : System::View<const Position, const Velocity>(ctx)) {
+        EXPECT_EQ(position.x, velocity.x * 2);
+    }
+
+    System::Group massive = makeGroup("massive", true);
+    System::Context massiveCtx{massive, world};
+    System::View<const Position, const Mass> partial(massiveCtx);
+    EXPECT_EQ(partial.getSize(), 334u);
+    EXPECT_THROW(partial.chunks([](std::span<const Position>, std::span<const Mass>) {}), Exception);
+
+    int total = 0;
+    partial.parallelEach([&](const Position&, const Mass& mass) { std::atomic_ref<int>(total) += mass.value; });
+    EXPECT_EQ(total, 166833);
+}
+
+/**
+ * @brief Tests that Changed and Added filters only visit what was touched since the system last ran, including changes
+ * made outside systems, and that a system does not see its own changes on its next run.
+ */
+TEST_F(ViewTest, FiltersChangedAndAdded) {
+    rome::b8 armed = false;
+    rome::u64 ownChanges = 0;
+    ecs.registerSystem(System::Builder("nudge", world).reads<Mass>().writes<Position>().allowPartial().build([&](System::Context& ctx) {
+        ownChanges = 0;
+        for ([[maybe_unused]] auto [mass] : System::View<const Mass, System::Changed<Position>>(ctx)) {
+            ownChanges++;
+        }
+        if (armed) {
+            System::View<Position, const Mass>(ctx).each([](Position& position, const Mass& mass) { position.x += mass.value; });
+        }
+    }));
+
+    rome::u64 changed = 0;
+    rome::u64 added = 0;
+    ecs.registerSystem(System::Builder("watch", world).reads<Position>().allowPartial().build([&](System::Context& ctx) {
+        changed = 0;
+        System::View<const Position, System::Changed<Position>>(ctx).each([&](const Position&) { changed++; });
+        added = 0;
+        System::View<const Position, System::Added<Position>>(ctx).parallelEach([&](const Position&) { std::atomic_ref<rome::u64>(added)++; });
+    }));
+    ASSERT_EQ(ecs.getScheduler().getStages().size(), 2u);
+
+    ecs.update();
+    EXPECT_EQ(ownChanges, 334u);
+    EXPECT_EQ(changed, 1000u);
+    EXPECT_EQ(added, 1000u);
+
+    ecs.update();
+    EXPECT_EQ(ownChanges, 0u);
+    EXPECT_EQ(changed, 0u);
+    EXPECT_EQ(added, 0u);
+
+    armed = true;
+    ecs.update();
+    EXPECT_EQ(ownChanges, 0u);
+    EXPECT_EQ(changed, 334u);
+    EXPECT_EQ(added, 0u);
+
+    armed = false;
+    ecs.update();
+    EXPECT_EQ(ownChanges, 0u);
+    EXPECT_EQ(changed, 0u);
+
+    ecs.addComponent<Position>(ecs.createEntity(), 0.0f);
+    world.components.markChanged<Position>(world.entities.get(1));
+    ecs.update();
+    EXPECT_EQ(ownChanges, 0u);
+    EXPECT_EQ(changed, 2u);
+    EXPECT_EQ(added, 1u);
+}
+
+/**
+ * @brief Tests that Exclude skips the entities holding an excluded component, and that Optional fetches a pointer that is
+ * null for the entities lacking the component.
+ */
+TEST_F(ViewTest, ExcludeAndOptional) {
+    const Component::ID frozen = ecs.registerComponent<Frozen>();
+    const Component::ID mass = ecs.registerComponent<Mass>();
+    System::Group group = makeGroup("move", false, BitSet<Component::ID>::create({frozen}), BitSet<Component::ID>::create({mass}));
+    System::Context ctx{group, world};
+
+    rome::u64 light = 0;
+    for ([[maybe_unused]] auto [position] : System::View<const Position, System::Exclude<Mass>>(ctx)) {
+        light++;
+    }
+    EXPECT_EQ(light, 666u);
+
+    rome::u64 thawed = 0;
+    System::View<const Position, System::Exclude<Frozen, Mass>>(ctx).parallelEach(
+        [&](const Position&) { std::atomic_ref<rome::u64>(thawed)++; });
+    EXPECT_EQ(thawed, 666u);
+
+    rome::u64 massive = 0;
+    int total = 0;
+    System::View<const Velocity, System::Optional<Mass>>(ctx).each([&](const Velocity& velocity, Mass* mass) {
+        if (!mass) return;
+        EXPECT_EQ(static_cast<float>(mass->value), velocity.x);
+        mass->value *= 2;
+        total += mass->value;
+        massive++;
+    });
+    EXPECT_EQ(massive, 334u);
+    EXPECT_EQ(total, 2 * 166833);
+
+    for (auto [velocity, mass] : System::View<const Velocity, System::Optional<const Mass>, System::Exclude<Frozen>>(ctx)) {
+        if (mass) {
+            EXPECT_EQ(static_cast<float>(mass->value), 2 * velocity.x);
+        }
+    }
+}
+
+/**
+ * @brief Tests that Optional and Exclude terms need the system to declare their components, which the scheduler then
+ * orders against the systems writing them.
+ */
+TEST_F(ViewTest, OptionalAccessIsDeclared) {
+    const Component::ID mass = ecs.registerComponent<Mass>();
+    System::Group undeclared = makeGroup("undeclared", false);
+    System::Context undeclaredCtx{undeclared, world};
+    EXPECT_THROW((System::View<const Velocity, System::Optional<const Mass>>(undeclaredCtx)), Exception);
+    EXPECT_THROW((System::View<const Velocity, System::Exclude<Mass>>(undeclaredCtx)), Exception);
+
+    System::Group reader = makeGroup("reader", false, BitSet<Component::ID>::create({mass}));
+    System::Context readerCtx{reader, world};
+    EXPECT_NO_THROW((System::View<const Velocity, System::Optional<const Mass>>(readerCtx)));
+    EXPECT_THROW((System::View<const Velocity, System::Optional<Mass>>(readerCtx)), Exception);
+
+    auto noop = [](System::Context&) {};
+    const System::ID weigh = ecs.registerSystem(System::Builder("weigh", world).writes<Position>().writesOptional<Mass>().build(noop));
+    const System::ID scale = ecs.registerSystem(System::Builder("scale", world).readsOptional<Mass>().build(noop));
+    const System::ID idle = ecs.registerSystem(System::Builder("idle", world).readsOptional<Velocity>().build(noop));
+    const std::vector<std::vector<System::ID>> expected{{weigh, idle}, {scale}};
+    EXPECT_EQ(ecs.getScheduler().getStages(), expected);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "concurrency/thread.hpp"
+#include "debug/metrics.hpp"
+#include "memory/arena.hpp"
+
+using namespace rome::core;
+
+/**
+ * @brief Tests that allocations are aligned, and that a reset hands the same memory out again.
+ */
+TEST(FrameArenaTest, BumpsAndResets) {
+    FrameArena arena(256);
+    void* first = arena.allocate(3, 1);
+    void* aligned = arena.allocate(16, 16);
+    EXPECT_EQ(reinterpret_cast<rome::u64>(aligned) % 16, 0u);
+    EXPECT_GE(arena.getUsed(), 19u);
+
+    std::pmr::vector<int> scratch(&arena);
+    scratch.assign(10, 7);
+    EXPECT_EQ(arena.getCapacity(), 256u);
+
+    arena.reset();
+    EXPECT_EQ(arena.getUsed(), 0u);
+    EXPECT_EQ(arena.allocate(3, 1), first);
+}
+
+/**
+ * @brief Tests that a frame spilling over several blocks gets a single block big enough for it after a reset.
+ */
+TEST(FrameArenaTest, MergesSpilledBlocks) {
+    FrameArena arena(128);
+    for (int i = 0; i < 10; i++) {
+        (void)arena.allocate(100, 8);
+    }
+    EXPECT_GT(arena.getCapacity(), 128u);
+    const rome::u64 highWater = arena.getHighWater();
+    EXPECT_GE(highWater, 1000u);
+
+    arena.reset();
+    const rome::u64 capacity = arena.getCapacity();
+    EXPECT_GE(capacity, highWater);
+    void* first = arena.allocate(100, 8);
+    for (int i = 0; i < 9; i++) {
+        (void)arena.allocate(100, 8);
+    }
+    EXPECT_EQ(arena.getCapacity(), capacity);
+    arena.reset();
+    EXPECT_EQ(arena.allocate(100, 8), first);
+    EXPECT_LE(arena.getHighWater(), capacity);
+}
+
+/**
+ * @brief Tests that ending a phase resets every thread's arena of that phase only, and reports the frame to the metrics.
+ */
+TEST(FrameArenaTest, EndsFramesAcrossThreads) {
+    Metrics::getInstance().registerThread("Arena Test");
+    FrameArena& tick = FrameArena::get(FrameArena::Phase::Tick);
+    FrameArena& render = FrameArena::get(FrameArena::Phase::Render);
+    EXPECT_EQ(&tick, &FrameArena::get(FrameArena::Phase::Tick));
+    EXPECT_NE(&tick, &render);
+    (void)tick.allocate(1000, 8);
+    (void)render.allocate(10, 8);
+
+    FrameArena* worker = nullptr;
+    Thread thread("Arena Worker");
+    thread.run([&worker]() {
+        worker = &FrameArena::get(FrameArena::Phase::Tick);
+        (void)worker->allocate(500, 8);
+    });
+    thread.join();
+
+    // The worker's arena went away with its thread
+    EXPECT_EQ(FrameArena::endFrame(FrameArena::Phase::Tick), 1000u);
+    EXPECT_EQ(tick.getUsed(), 0u);
+    EXPECT_EQ(render.getUsed(), 10u);
+    EXPECT_GE(Metrics::getInstance().getArenaPeakBytes(), 1000u);
+    Metrics::getInstance().unregisterThread();
+}
+
+/**
+ * @brief Tests that a phase ended by one thread reports each arena's usage against the thread owning it.
+ */
+TEST(FrameArenaTest, ReportsUsageToOwningThreads) {
+    std::atomic<int> stage = 0;
+    UUID id;
+    rome::u64 peak = 0;
+    Thread thread("Arena Owner");
+    thread.run([&]() {
+        Metrics::getInstance().registerThread("Arena Owner");
+        id = ThreadInfo::getLocalID();
+        (void)FrameArena::get(FrameArena::Phase::Render).allocate(700, 8);
+        stage = 1;
+        stage.wait(1);
+        peak = Metrics::getInstance().getArenaPeakBytes();
+        Metrics::getInstance().unregisterThread();
+    });
+    stage.wait(0);
+
+    Metrics::getInstance().registerThread("Arena Ender");
+    (void)FrameArena::get(FrameArena::Phase::Render).allocate(100, 8);
+    EXPECT_GE(FrameArena::endFrame(FrameArena::Phase::Render), 800u);
+    EXPECT_EQ(Metrics::getInstance().getArenaPeakBytes(id), 700u);
+    EXPECT_LT(Metrics::getInstance().getArenaPeakBytes(), 700u);
+    Metrics::getInstance().unregisterThread();
+
+    stage = 2;
+    stage.notify_one();
+    thread.join();
+    EXPECT_EQ(peak, 700u);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "ecs/component/registry.hpp"
+#include "ecs/event/bus.hpp"
+#include "memory/slab_pool.hpp"
+#include "reflection/traits/field.hpp"
+
+using namespace rome::core;
+
+namespace {
+    struct Health {
+        int value;
+
+        RM_REFLECT;
+    };
+
+    struct Hit {
+        int damage;
+
+        RM_REFLECT;
+    };
+}  // namespace
+RM_REFLECT_IMPL(Health, "SlabHealth", Fields().with("value", &Health::value));
+RM_REFLECT_IMPL(Hit, "SlabHit", Fields().with("damage", &Hit::damage));
+
+/**
+ * @brief Tests that freed blocks are handed out again, and that blocks honour their alignment.
+ */
+TEST(SlabPoolTest, RecyclesAndAligns) {
+    SlabPool pool;
+    void* block = pool.allocate(24, 8);
+    pool.deallocate(block, 24, 8);
+    EXPECT_EQ(pool.allocate(24, 8), block);
+    EXPECT_EQ(pool.getSlabCount(), 1u);
+
+    for (rome::u64 alignment = 1; alignment <= SlabPool::PageAlignment; alignment *= 2) {
+        void* aligned = pool.allocate(alignment, alignment);
+        EXPECT_EQ(reinterpret_cast<rome::u64>(aligned) % alignment, 0u) << "alignment " << alignment;
+    }
+}
+
+/**
+ * @brief Tests that live blocks never overlap, across several slabs.
+ */
+TEST(SlabPoolTest, BlocksDoNotOverlap) {
+    SlabPool pool(1024);
+    std::vector<rome::u64*> blocks;
+    for (rome::u64 i = 0; i < 1000; i++) {
+        rome::u64* block = static_cast<rome::u64*>(pool.allocate(sizeof(rome::u64) * 4, alignof(rome::u64)));
+        std::fill_n(block, 4, i);
+        blocks.push_back(block);
+    }
+    EXPECT_GT(pool.getSlabCount(), 1u);
+    for (rome::u64 i = 0; i < blocks.size(); i++) {
+        EXPECT_EQ(blocks[i][0], i);
+        EXPECT_EQ(blocks[i][3], i);
+    }
+}
+
+/**
+ * @brief Tests that requests past the largest size class bypass the slabs.
+ */
+TEST(SlabPoolTest, LargeRequestsGoUpstream) {
+    SlabPool pool;
+    void* large = pool.allocate(SlabPool::MaxBlockSize + 1, 8);
+    EXPECT_EQ(pool.getSlabCount(), 0u);
+    pool.deallocate(large, SlabPool::MaxBlockSize + 1, 8);
+}
+
+/**
+ * @brief Tests that blocks can be freed on another thread than the one that allocated them.
+ */
+TEST(SlabPoolTest, FreesAcrossThreads) {
+    SlabPool pool;
+    constexpr rome::u64 count = 10000;
+    std::vector<void*> blocks(count);
+
+    std::thread producer([&] {
+        for (void*& block : blocks) {
+            block = pool.allocate(48, 16);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&] {
+        for (void* block : blocks) {
+            pool.deallocate(block, 48, 16);
+        }
+    });
+    consumer.join();
+
+    // The blocks went back to the pool, so a second round does not need new slabs
+    const rome::u64 slabs = pool.getSlabCount();
+    std::thread again([&] {
+        for (void*& block : blocks) {
+            block = pool.allocate(48, 16);
+        }
+        for (void* block : blocks) {
+            pool.deallocate(block, 48, 16);
+        }
+    });
+    again.join();
+    EXPECT_EQ(pool.getSlabCount(), slabs);
+}
+
+/**
+ * @brief Tests that the blocks cached by a thread go back to the pool when its cache is evicted, and when it exits.
+ */
+TEST(SlabPoolTest, ReleasesThreadCaches) {
+    // 64 KiB blocks come four to a slab, and a thread cache keeps one of them
+    constexpr rome::u64 size = 1 << 16;
+    auto cycle = [](SlabPool& pool) {
+        void* blocks[4];
+        for (void*& block : blocks) {
+            block = pool.allocate(size);
+        }
+        for (void* block : blocks) {
+            pool.deallocate(block, size);
+        }
+    };
+
+    SlabPool evicted;
+    cycle(evicted);
+    SlabPool others[16];
+    for (SlabPool& other : others) {
+        other.deallocate(other.allocate(16), 16);
+    }
+    cycle(evicted);
+    EXPECT_EQ(evicted.getSlabCount(), 1u);
+
+    SlabPool exited;
+    std::thread thread([&] { cycle(exited); });
+    thread.join();
+    cycle(exited);
+    EXPECT_EQ(exited.getSlabCount(), 1u);
+}
+
+/**
+ * @brief Tests that component pools and event queues allocate from the resource they are given.
+ */
+TEST(SlabPoolTest, BacksComponentsAndEvents) {
+    SlabPool pool;
+    Entity::Registry entities;
+    Component::Registry components;
+    components.setResource(&pool);
+
+    for (int i = 0; i < 100; i++) {
+        components.create<Health>(entities.create(), Health{i});
+    }
+    EXPECT_EQ(components.getPool<Health>()->getResource(), &pool);
+    EXPECT_GT(pool.getSlabCount(), 0u);
+
+    Event::Storage<Hit> queue(&pool);
+    queue.push(Hit{3});
+    queue.emplace(Hit{4});
+    queue.swap();
+    ASSERT_EQ(queue.read().size(), 2u);
+    EXPECT_EQ(queue.read()[1].damage, 4);
+}